@@ -0,0 +1,163 @@
+/**
+ * @file
+ * @brief Accumulator class for summing many Nat values with deferred carries
+ * @note This file forms part of arby
+ * @details arby is a C++ library providing arbitrary-precision integer types
+ * @warning arby is alpha-quality software
+ *
+ * @author Joshua Saxby <joshua.a.saxby@gmail.com>
+ * @date May 2022
+ *
+ * @copyright Copyright Joshua Saxby <joshua.a.saxby@gmail.com> 2022
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef COM_SAXBOPHONE_ARBY_ACCUMULATOR_HPP
+#define COM_SAXBOPHONE_ARBY_ACCUMULATOR_HPP
+
+#include <cstddef> // size_t
+
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <codlili/list.hpp>
+
+#include <arby/Nat.hpp>
+
+
+namespace com::saxbophone::arby {
+    /**
+     * @brief Sums many Nat values without propagating carries between them
+     * @details Each digit position gets its own counter, twice as wide as a
+     * digit, which additions are simply added into. Carries are only
+     * propagated when the value is read, or on the rare occasion that enough
+     * values have been added that the counters could otherwise overflow.
+     * Adding a value is therefore a single pass over its digits, with no
+     * carry chains and no temporary Nat values, and the carries are applied
+     * in a single pass when they are propagated. The counters still grow to
+     * fit the longest value added.
+     * @code
+     * arby::Accumulator total;
+     * for (const auto& value : values) {
+     *     total += value;
+     * }
+     * arby::Nat sum = total.value();
+     * @endcode
+     */
+    class Accumulator {
+    public:
+        /**
+         * @brief Default constructor, initialises to numeric value `0`
+         */
+        Accumulator() {}
+
+        /**
+         * @brief Initialises with the given value
+         */
+        Accumulator(const Nat& value) {
+            *this += value;
+        }
+
+        /**
+         * @brief Adds the given value to the running total
+         * @note Complexity: @f$ \mathcal{O(n)} @f$ in the number of digits of
+         * `value` only, amortised
+         */
+        Accumulator& operator+=(const Nat& value) {
+            if (_pending == MAX_PENDING) {
+                _propagate_carries();
+            }
+            if (_counters.size() < value._digits.size()) {
+                _counters.resize(value._digits.size(), 0);
+            }
+            auto counter = _counters.begin();
+            for (auto it = value._digits.rbegin(); it != value._digits.rend(); it++, counter++) {
+                *counter += *it;
+            }
+            _pending++;
+            return *this;
+        }
+
+        /**
+         * @returns The running total, with all carries propagated
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         */
+        Nat value() const {
+            Nat result;
+            if (_counters.empty()) { return result; }
+            codlili::list<Nat::StorageType> digits;
+            Counter carry = 0;
+            for (Counter counter : _counters) {
+                // can't overflow, as counters never exceed (BASE - 1)² and carries are less than BASE
+                Counter sum = counter + carry;
+                digits.push_front((Nat::StorageType)sum);
+                carry = sum >> Nat::BITS_PER_DIGIT;
+            }
+            while (carry != 0) {
+                digits.push_front((Nat::StorageType)carry);
+                carry >>= Nat::BITS_PER_DIGIT;
+            }
+            result._digits = std::move(digits);
+            result._remove_leading_zeroes();
+            return result;
+        }
+
+        /**
+         * @returns The running total, with all carries propagated
+         */
+        explicit operator Nat() const {
+            return value();
+        }
+
+    private:
+        using Counter = Nat::OverflowType;
+
+        /*
+         * every counter is at most _pending × (BASE - 1), so this many
+         * additions keeps them within (BASE - 1)², which Counter can hold
+         */
+        static constexpr std::size_t MAX_PENDING = std::numeric_limits<Nat::StorageType>::max();
+
+        // brings every counter back into the range of a single digit, as if only one value had been added
+        void _propagate_carries() {
+            Counter carry = 0;
+            for (Counter& counter : _counters) {
+                Counter sum = counter + carry;
+                counter = (Nat::StorageType)sum;
+                carry = sum >> Nat::BITS_PER_DIGIT;
+            }
+            while (carry != 0) {
+                _counters.push_back((Nat::StorageType)carry);
+                carry >>= Nat::BITS_PER_DIGIT;
+            }
+            _pending = 1;
+        }
+
+        std::vector<Counter> _counters; // least significant first, unlike Nat's digits
+        std::size_t _pending = 0; // number of values added since counters were last within a digit
+    };
+
+    /**
+     * @brief Sums a range of values, like `std::accumulate()`
+     * @details Uses Accumulator, so carries are only propagated once at the end
+     * @param first,last range of values convertible to Nat
+     * @param init value to start the sum from
+     * @returns \f$init+\sum_{i=first}^{last}i\f$
+     */
+    template <std::input_iterator InputIt>
+    Nat sum(InputIt first, InputIt last, const Nat& init = 0) {
+        Accumulator total = init;
+        for (; first != last; first++) {
+            total += *first;
+        }
+        return total.value();
+    }
+}
+
+#endif // include guard
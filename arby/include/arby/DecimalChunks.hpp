@@ -0,0 +1,162 @@
+/**
+ * @file
+ * @brief DecimalChunks range for generating the decimal digits of a Nat lazily
+ * @note This file forms part of arby
+ * @details arby is a C++ library providing arbitrary-precision integer types
+ * @warning arby is alpha-quality software
+ *
+ * @author Joshua Saxby <joshua.a.saxby@gmail.com>
+ * @date May 2022
+ *
+ * @copyright Copyright Joshua Saxby <joshua.a.saxby@gmail.com> 2022
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef COM_SAXBOPHONE_ARBY_DECIMAL_CHUNKS_HPP
+#define COM_SAXBOPHONE_ARBY_DECIMAL_CHUNKS_HPP
+
+#include <cstddef> // size_t, ptrdiff_t
+#include <cstdint>
+
+#include <array>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include <arby/Nat.hpp>
+
+
+namespace com::saxbophone::arby {
+    /**
+     * @brief Single-pass range over the decimal digits of a Nat, in blocks of
+     * BLOCK_SIZE digits, most significant first
+     * @details Every block but the first is exactly BLOCK_SIZE digits long,
+     * leading zeroes included, while the first has no leading zeroes (unless
+     * the value is zero, which is the single block `0`). Digits are only
+     * worked out as blocks are asked for, by splitting the value in half by
+     * powers of ten as for conversion to string, but with the halves still
+     * to be written kept on a stack. As the halves get smaller all the way up
+     * the stack, memory use stays proportional to the size of the Nat rather
+     * than its string.
+     * @code
+     * for (std::string_view block : arby::decimal_chunks(value)) {
+     *     file.write(block.data(), (std::streamsize)block.size());
+     * }
+     * @endcode
+     * @note Each block is only valid until the iterator is next incremented,
+     * and the range must outlive its iterators
+     */
+    class DecimalChunks {
+    public:
+        /**
+         * @brief Input iterator over the blocks of a DecimalChunks
+         */
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag; /**< @brief iterator category */
+            using value_type = std::string_view; /**< @brief type of the blocks */
+            using difference_type = std::ptrdiff_t; /**< @brief difference type */
+
+            iterator() = default;
+
+            /**
+             * @returns the current block of digits
+             */
+            std::string_view operator*() const {
+                return {_chunks->_block.data(), _chunks->_length};
+            }
+
+            /**
+             * @brief moves on to the next block, working out its digits
+             */
+            iterator& operator++() {
+                _chunks->_advance();
+                return *this;
+            }
+
+            /**
+             * @brief moves on to the next block, working out its digits
+             */
+            void operator++(int) {
+                ++*this;
+            }
+
+            /**
+             * @returns whether all blocks have been generated
+             */
+            bool operator==(std::default_sentinel_t) const {
+                return _chunks->_done;
+            }
+
+        private:
+            friend class DecimalChunks;
+
+            explicit iterator(DecimalChunks* chunks) : _chunks(chunks) {}
+
+            DecimalChunks* _chunks = nullptr;
+        };
+
+        // as many digits as always fit into uintmax_t, 19 for 64 bits
+        static constexpr std::size_t CHUNK = PRIVATE::fit(std::numeric_limits<uintmax_t>::max(), 10) - 1;
+        // each block is CHUNK × 2ᴮᴸᴼᶜᴷ⁻ᴸᴱⱽᴱᴸ digits
+        static constexpr std::size_t BLOCK_LEVEL = 6;
+        /**
+         * @brief number of digits in every block but the first
+         */
+        static constexpr std::size_t BLOCK_SIZE = CHUNK << BLOCK_LEVEL;
+
+        /**
+         * @brief Prepares to generate the digits of the given value, working
+         * out the first block
+         */
+        explicit DecimalChunks(const Nat& value);
+
+        /**
+         * @returns iterator to the first block
+         * @note DecimalChunks is single-pass, so all iterators share the same
+         * position
+         */
+        iterator begin() {
+            return iterator(this);
+        }
+
+        /**
+         * @returns sentinel marking the end of the blocks
+         */
+        std::default_sentinel_t end() const {
+            return {};
+        }
+
+    private:
+        struct Frame {
+            Nat value;
+            std::size_t level; // value has CHUNK × 2ˡᵉᵛᵉˡ digits, or up to that many if not padded
+            bool padded; // whether leading zeroes are written
+        };
+
+        // works out the next block, or marks the range as done if there isn't one
+        void _advance();
+
+        std::vector<Nat> _powers; // 10^(CHUNK × 2ⁱ)
+        std::vector<Frame> _stack; // parts of the value still to be written, least significant at the bottom
+        std::array<char, BLOCK_SIZE> _block; // digits of the current block
+        std::size_t _length = 0; // number of digits in the current block
+        bool _done = false;
+    };
+
+    /**
+     * @brief Generates the decimal digits of a Nat lazily, in blocks
+     * @returns DecimalChunks range over the digits of value
+     * @relates com::saxbophone::arby::DecimalChunks
+     */
+    inline DecimalChunks decimal_chunks(const Nat& value) {
+        return DecimalChunks(value);
+    }
+}
+
+#endif // include guard
@@ -0,0 +1,486 @@
+/**
+ * @file
+ * @brief Opt-in expression templates for evaluating compound Nat arithmetic
+ * without temporaries
+ * @note This file forms part of arby
+ * @details arby is a C++ library providing arbitrary-precision integer types
+ * @warning arby is alpha-quality software
+ *
+ * @author Joshua Saxby <joshua.a.saxby@gmail.com>
+ * @date May 2022
+ *
+ * @copyright Copyright Joshua Saxby <joshua.a.saxby@gmail.com> 2022
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef COM_SAXBOPHONE_ARBY_EXPRESSION_HPP
+#define COM_SAXBOPHONE_ARBY_EXPRESSION_HPP
+
+#include <cstdint>
+
+#include <concepts>
+#include <type_traits>
+
+#include <arby/Nat.hpp>
+
+
+namespace com::saxbophone::arby {
+    /**
+     * @brief Types which describe an arithmetic expression over Nat values
+     * that hasn't been evaluated yet
+     * @details Every expression can be evaluated into a destination Nat, and
+     * added to or subtracted from one, and can report whether it refers to a
+     * given Nat, so that evaluating in place can be avoided when it would
+     * change the expression's own operands.
+     */
+    template <typename T>
+    concept Expression = requires(const T& expression, Nat& destination) {
+        expression.evaluate_into(destination);
+        expression.accumulate_into(destination, true);
+        { expression.refers_to(destination) } -> std::same_as<bool>;
+    };
+
+    /**
+     * @brief Types which can appear on either side of an operator in an
+     * Expression, i.e. expressions themselves, Nat values or integers
+     */
+    template <typename T>
+    concept Operand = Expression<T> or std::same_as<T, Nat> or std::integral<T>;
+
+    /**
+     * @brief Expression template nodes, as built by lazy() and the operators
+     * @note There's usually no need to name these types, use `auto` or
+     * convert straight to Nat instead
+     */
+    namespace expression {
+        /**
+         * @brief Base of all expression nodes, provides evaluation by
+         * conversion to Nat
+         */
+        template <typename Derived>
+        struct Node {
+            /**
+             * @brief Evaluates the expression
+             */
+            constexpr operator Nat() const {
+                Nat result;
+                static_cast<const Derived&>(*this).evaluate_into(result);
+                return result;
+            }
+
+            /**
+             * @brief Adds or subtracts the expression to or from `destination`
+             * @note This is the fallback for nodes which can't do any better
+             * than evaluating in full first
+             */
+            constexpr void accumulate_into(Nat& destination, bool subtract) const {
+                Nat value = *this;
+                if (subtract) {
+                    destination -= value;
+                } else {
+                    destination += value;
+                }
+            }
+        };
+
+        /**
+         * @brief Leaf of an expression, refers to a Nat without copying it
+         */
+        struct Reference : public Node<Reference> {
+            constexpr explicit Reference(const Nat& value) : value(value) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                destination = value;
+            }
+
+            constexpr void accumulate_into(Nat& destination, bool subtract) const {
+                if (subtract) {
+                    destination -= value;
+                } else {
+                    destination += value;
+                }
+            }
+
+            constexpr bool refers_to(const Nat& other) const {
+                return &value == &other;
+            }
+
+            const Nat& value;
+        };
+
+        /**
+         * @brief Leaf of an expression, holds an integer operand as a Nat
+         */
+        struct Constant : public Node<Constant> {
+            constexpr explicit Constant(uintmax_t value) : value(value) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                destination = value;
+            }
+
+            constexpr void accumulate_into(Nat& destination, bool subtract) const {
+                if (subtract) {
+                    destination -= value;
+                } else {
+                    destination += value;
+                }
+            }
+
+            constexpr bool refers_to(const Nat&) const {
+                return false;
+            }
+
+            Nat value;
+        };
+
+        // wraps Nat operands as References and integers as Constants, passes expressions through unchanged
+        constexpr Reference as_expression(const Nat& value) {
+            return Reference(value);
+        }
+
+        template <std::integral T>
+        constexpr Constant as_expression(T value) {
+            return Constant((uintmax_t)value);
+        }
+
+        template <Expression E>
+        constexpr const E& as_expression(const E& expression) {
+            return expression;
+        }
+
+        // the value of an operand, only evaluating it if it isn't a Nat already
+        constexpr const Nat& operand_value(const Reference& reference) {
+            return reference.value;
+        }
+
+        constexpr const Nat& operand_value(const Constant& constant) {
+            return constant.value;
+        }
+
+        template <Expression E>
+        constexpr Nat operand_value(const E& expression) {
+            return expression;
+        }
+
+        /**
+         * @brief Addition of two expressions
+         * @details When evaluated, every term of a chain of sums and
+         * differences is accumulated straight into the destination, with
+         * products done as fused multiply-adds
+         */
+        template <Expression L, Expression R>
+        struct Sum : public Node<Sum<L, R>> {
+            constexpr Sum(const L& left, const R& right) : left(left), right(right) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                destination = 0;
+                accumulate_into(destination, false);
+            }
+
+            constexpr void accumulate_into(Nat& destination, bool subtract) const {
+                // a - (b + c) underflows exactly when a - b - c does, so this is safe to flatten either way
+                left.accumulate_into(destination, subtract);
+                right.accumulate_into(destination, subtract);
+            }
+
+            constexpr bool refers_to(const Nat& other) const {
+                return left.refers_to(other) or right.refers_to(other);
+            }
+
+            L left;
+            R right;
+        };
+
+        /**
+         * @brief Subtraction of two expressions
+         * @throws std::underflow_error when evaluated, if the result would be
+         * negative
+         */
+        template <Expression L, Expression R>
+        struct Difference : public Node<Difference<L, R>> {
+            constexpr Difference(const L& left, const R& right) : left(left), right(right) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                destination = 0;
+                accumulate_into(destination, false);
+            }
+
+            constexpr void accumulate_into(Nat& destination, bool subtract) const {
+                if (subtract or destination) {
+                    /*
+                     * neither a - (b - c) nor a + (b - c) can be flattened
+                     * into a - b + c or a + b - c, as b - c underflows on its
+                     * own where those wouldn't. Only when adding to zero are
+                     * the two the same
+                     */
+                    Node<Difference>::accumulate_into(destination, subtract);
+                    return;
+                }
+                left.accumulate_into(destination, false);
+                right.accumulate_into(destination, true);
+            }
+
+            constexpr bool refers_to(const Nat& other) const {
+                return left.refers_to(other) or right.refers_to(other);
+            }
+
+            L left;
+            R right;
+        };
+
+        /**
+         * @brief Multiplication of two expressions
+         * @details When added to or subtracted from something, this uses
+         * addmul() or submul() rather than forming the product separately
+         */
+        template <Expression L, Expression R>
+        struct Product : public Node<Product<L, R>> {
+            constexpr Product(const L& left, const R& right) : left(left), right(right) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                destination = operand_value(left) * operand_value(right);
+            }
+
+            constexpr void accumulate_into(Nat& destination, bool subtract) const {
+                if (subtract) {
+                    submul(destination, operand_value(left), operand_value(right));
+                } else {
+                    addmul(destination, operand_value(left), operand_value(right));
+                }
+            }
+
+            constexpr bool refers_to(const Nat& other) const {
+                return left.refers_to(other) or right.refers_to(other);
+            }
+
+            L left;
+            R right;
+        };
+
+        /**
+         * @brief Left bit-shift of an expression, evaluated in place
+         */
+        template <Expression E>
+        struct LeftShift : public Node<LeftShift<E>> {
+            constexpr LeftShift(const E& value, uintmax_t shift) : value(value), shift(shift) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                value.evaluate_into(destination);
+                destination <<= shift;
+            }
+
+            constexpr bool refers_to(const Nat& other) const {
+                return value.refers_to(other);
+            }
+
+            E value;
+            uintmax_t shift;
+        };
+
+        /**
+         * @brief Right bit-shift of an expression, evaluated in place
+         */
+        template <Expression E>
+        struct RightShift : public Node<RightShift<E>> {
+            constexpr RightShift(const E& value, uintmax_t shift) : value(value), shift(shift) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                value.evaluate_into(destination);
+                destination >>= shift;
+            }
+
+            constexpr bool refers_to(const Nat& other) const {
+                return value.refers_to(other);
+            }
+
+            E value;
+            uintmax_t shift;
+        };
+
+        /**
+         * @brief Bitwise OR of two expressions
+         * @details The left side is evaluated straight into the destination and
+         * the right side combined with it in place, so `(x << n) | y` costs no
+         * more than a shift and an in-place OR
+         */
+        template <Expression L, Expression R>
+        struct BitwiseOr : public Node<BitwiseOr<L, R>> {
+            constexpr BitwiseOr(const L& left, const R& right) : left(left), right(right) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                left.evaluate_into(destination);
+                destination |= operand_value(right);
+            }
+
+            constexpr bool refers_to(const Nat& other) const {
+                return left.refers_to(other) or right.refers_to(other);
+            }
+
+            L left;
+            R right;
+        };
+
+        /**
+         * @brief Bitwise AND of two expressions, evaluated as for BitwiseOr
+         */
+        template <Expression L, Expression R>
+        struct BitwiseAnd : public Node<BitwiseAnd<L, R>> {
+            constexpr BitwiseAnd(const L& left, const R& right) : left(left), right(right) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                left.evaluate_into(destination);
+                destination &= operand_value(right);
+            }
+
+            constexpr bool refers_to(const Nat& other) const {
+                return left.refers_to(other) or right.refers_to(other);
+            }
+
+            L left;
+            R right;
+        };
+
+        /**
+         * @brief Bitwise XOR of two expressions, evaluated as for BitwiseOr
+         */
+        template <Expression L, Expression R>
+        struct BitwiseXor : public Node<BitwiseXor<L, R>> {
+            constexpr BitwiseXor(const L& left, const R& right) : left(left), right(right) {}
+
+            constexpr void evaluate_into(Nat& destination) const {
+                left.evaluate_into(destination);
+                destination ^= operand_value(right);
+            }
+
+            constexpr bool refers_to(const Nat& other) const {
+                return left.refers_to(other) or right.refers_to(other);
+            }
+
+            L left;
+            R right;
+        };
+
+        // the node type for an operand, once wrapped
+        template <Operand T>
+        using node_t = std::remove_cvref_t<decltype(as_expression(std::declval<const T&>()))>;
+
+        /*
+         * operators only take part when at least one side is already an
+         * expression, so that plain Nat arithmetic is left alone
+         */
+
+        template <Operand L, Operand R> requires (Expression<L> or Expression<R>)
+        constexpr Sum<node_t<L>, node_t<R>> operator+(const L& lhs, const R& rhs) {
+            return {as_expression(lhs), as_expression(rhs)};
+        }
+
+        template <Operand L, Operand R> requires (Expression<L> or Expression<R>)
+        constexpr Difference<node_t<L>, node_t<R>> operator-(const L& lhs, const R& rhs) {
+            return {as_expression(lhs), as_expression(rhs)};
+        }
+
+        template <Operand L, Operand R> requires (Expression<L> or Expression<R>)
+        constexpr Product<node_t<L>, node_t<R>> operator*(const L& lhs, const R& rhs) {
+            return {as_expression(lhs), as_expression(rhs)};
+        }
+
+        template <Operand L, Operand R> requires (Expression<L> or Expression<R>)
+        constexpr BitwiseOr<node_t<L>, node_t<R>> operator|(const L& lhs, const R& rhs) {
+            return {as_expression(lhs), as_expression(rhs)};
+        }
+
+        template <Operand L, Operand R> requires (Expression<L> or Expression<R>)
+        constexpr BitwiseAnd<node_t<L>, node_t<R>> operator&(const L& lhs, const R& rhs) {
+            return {as_expression(lhs), as_expression(rhs)};
+        }
+
+        template <Operand L, Operand R> requires (Expression<L> or Expression<R>)
+        constexpr BitwiseXor<node_t<L>, node_t<R>> operator^(const L& lhs, const R& rhs) {
+            return {as_expression(lhs), as_expression(rhs)};
+        }
+
+        template <Expression E>
+        constexpr LeftShift<E> operator<<(const E& lhs, uintmax_t rhs) {
+            return {lhs, rhs};
+        }
+
+        template <Expression E>
+        constexpr RightShift<E> operator>>(const E& lhs, uintmax_t rhs) {
+            return {lhs, rhs};
+        }
+
+        // comparisons evaluate the expression sides, then compare as Nat does
+
+        template <Operand L, Operand R> requires (Expression<L> or Expression<R>)
+        constexpr bool operator==(const L& lhs, const R& rhs) {
+            return operand_value(as_expression(lhs)) == operand_value(as_expression(rhs));
+        }
+
+        template <Operand L, Operand R> requires (Expression<L> or Expression<R>)
+        constexpr auto operator<=>(const L& lhs, const R& rhs) {
+            return operand_value(as_expression(lhs)) <=> operand_value(as_expression(rhs));
+        }
+
+        /**
+         * @brief Accumulates an expression into `lhs`, fusing any products
+         * @note If the expression refers to `lhs` itself, it is evaluated in
+         * full first so that the result matches eager evaluation
+         */
+        template <Expression E>
+        constexpr Nat& operator+=(Nat& lhs, const E& rhs) {
+            if (rhs.refers_to(lhs)) {
+                return lhs += (Nat)rhs;
+            }
+            rhs.accumulate_into(lhs, false);
+            return lhs;
+        }
+
+        /**
+         * @brief Subtracts an expression from `lhs`, fusing any products
+         * @throws std::underflow_error when the expression's value is greater
+         * than `lhs`
+         * @note If the expression refers to `lhs` itself, it is evaluated in
+         * full first so that the result matches eager evaluation
+         */
+        template <Expression E>
+        constexpr Nat& operator-=(Nat& lhs, const E& rhs) {
+            if (rhs.refers_to(lhs)) {
+                return lhs -= (Nat)rhs;
+            }
+            rhs.accumulate_into(lhs, true);
+            return lhs;
+        }
+    }
+
+    /**
+     * @brief Opts a Nat into lazy evaluation, so that arithmetic involving
+     * it builds an Expression instead of computing each step separately
+     * @details The expression is evaluated when converted to Nat, at which
+     * point chains of additions and subtractions are accumulated straight into
+     * the result with products fused into them (as by addmul() and submul()),
+     * and shifts and bitwise operations are done in place:
+     * @code
+     * using arby::lazy;
+     * arby::Nat r = lazy(a) * b + lazy(c) * d - e; // one result, no temporaries
+     * arby::Nat s = (lazy(x) << 3) | y;            // shifted and OR'd in place
+     * r += lazy(a) * b;                            // same as addmul(r, a, b)
+     * @endcode
+     * Terms are evaluated left to right, as eager evaluation would, so an
+     * expression throws std::underflow_error exactly when the equivalent
+     * expression without lazy() would.
+     * @warning Expressions refer to their Nat operands rather than copying
+     * them, so they must be evaluated before any of those operands go out of
+     * scope. Convert to Nat rather than storing an expression in an `auto`
+     * variable, unless all its operands outlive it.
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr expression::Reference lazy(const Nat& value) {
+        return expression::Reference(value);
+    }
+}
+
+#endif // include guard
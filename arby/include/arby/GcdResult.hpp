@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @brief GcdResult<T> struct represents results of extended greatest common divisor
+ * @note This file forms part of arby
+ * @details arby is a C++ library providing arbitrary-precision integer types
+ * @warning arby is alpha-quality software
+ *
+ * @author Joshua Saxby <joshua.a.saxby@gmail.com>
+ * @date May 2022
+ *
+ * @copyright Copyright Joshua Saxby <joshua.a.saxby@gmail.com> 2022
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef COM_SAXBOPHONE_ARBY_GCD_RESULT_HPP
+#define COM_SAXBOPHONE_ARBY_GCD_RESULT_HPP
+
+#include <concepts> // convertible_to
+#include <tuple> // tuple
+#include <type_traits>
+
+#include <cstddef> // size_t
+
+
+namespace com::saxbophone::arby {
+    /**
+     * @brief Represents the result of extended greatest common divisor
+     * @details For some values \f$a\f$ and \f$b\f$, this holds
+     * \f$gcd=\gcd(a,b)\f$ and the Bézout coefficients \f$x\f$ and \f$y\f$,
+     * such that \f$ax-by=gcd\f$
+     * @note As the coefficients are unsigned, the second one is subtracted
+     * rather than added as it usually is in Bézout's identity
+     * @note GcdResult supports being used in structured bindings, i.e. the
+     * following code is valid:
+     * @code
+     * auto [gcd, x, y] = GcdResult();
+     * @endcode
+     */
+    template <typename T>
+    struct GcdResult {
+        /**
+         * @brief Default-initialises gcd and both coefficients
+         */
+        constexpr GcdResult() {}
+
+        /**
+         * @brief Initialises gcd and both coefficients to separate values
+         */
+        constexpr GcdResult(T gcd, T x, T y) : gcd(gcd), x(x), y(y) {}
+
+        /**
+         * @brief Provides support for structured bindings
+         * @note We only provide access as a copy
+         */
+        template <std::size_t N>
+        constexpr typename std::tuple_element<N, GcdResult>::type get() const {
+            if constexpr (N == 0) return gcd;
+            else if constexpr (N == 1) return x;
+            else if constexpr (N == 2) return y;
+        }
+
+        /**
+         * @brief cast to other template of self
+         * @pre `(U)T{}` must be well-defined
+         */
+        template <typename U> requires std::convertible_to<T, U>
+        constexpr operator GcdResult<U>() const {
+            return {(U)gcd, (U)x, (U)y};
+        }
+
+        /**
+         * @brief enables defaulted equality-comparison between GcdResults
+         */
+        constexpr bool operator==(const GcdResult& other) const = default;
+
+        T gcd = {}; /**< greatest common divisor */
+        T x = {}; /**< coefficient of the first value */
+        T y = {}; /**< coefficient of the second value, which is subtracted */
+    };
+}
+
+/**
+ * @note for structured binding support
+ */
+template <typename T>
+struct std::tuple_size<com::saxbophone::arby::GcdResult<T>> : std::integral_constant<std::size_t, 3> {};
+
+/**
+ * @note for structured binding support
+ */
+template <std::size_t N, typename T>
+struct std::tuple_element<N, com::saxbophone::arby::GcdResult<T>> {
+    using type = T; /**< required for structured binding support */
+};
+
+#endif // include guard
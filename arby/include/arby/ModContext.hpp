@@ -0,0 +1,178 @@
+/**
+ * @file
+ * @brief ModContext class for repeated modular arithmetic with a fixed modulus
+ * @note This file forms part of arby
+ * @details arby is a C++ library providing arbitrary-precision integer types
+ * @warning arby is alpha-quality software
+ *
+ * @author Joshua Saxby <joshua.a.saxby@gmail.com>
+ * @date May 2022
+ *
+ * @copyright Copyright Joshua Saxby <joshua.a.saxby@gmail.com> 2022
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef COM_SAXBOPHONE_ARBY_MOD_CONTEXT_HPP
+#define COM_SAXBOPHONE_ARBY_MOD_CONTEXT_HPP
+
+#include <cstddef> // size_t
+
+#include <limits>
+#include <stdexcept>
+
+#include <arby/Nat.hpp>
+
+
+namespace com::saxbophone::arby {
+    /**
+     * @brief Performs modular arithmetic with a fixed modulus, reusing
+     * everything that can be worked out from the modulus alone
+     * @details The Barrett reciprocal \f$\mu=\lfloor\frac{BASE^{2k}}{modulus}\rfloor\f$
+     * (where \f$k\f$ is the number of digits of the modulus) is computed once
+     * on construction, after which reduce() needs only multiplications and
+     * shifts. Odd moduli additionally get Montgomery constants, which all
+     * operations use instead, so as to avoid full-width products altogether.
+     * @note All operations are `const` and nothing is cached after
+     * construction, so one ModContext may be shared between threads for as
+     * long as none of them assigns to it.
+     * @note Operands may be of any size, those which are not already less
+     * than the modulus get reduced first.
+     */
+    class ModContext {
+    public:
+        /**
+         * @brief Precomputes the constants for the given modulus
+         * @throws std::domain_error when `modulus` is zero
+         */
+        constexpr explicit ModContext(const Nat& modulus)
+          : _modulus(modulus)
+          , _size(modulus.digit_length())
+          {
+            if (not modulus) { throw std::domain_error("ModContext: modulus cannot be zero"); }
+            _reciprocal = (Nat(1) << (2 * _size * DIGIT_BITS)) / modulus;
+            if (modulus & 1) {
+                _montgomery = PRIVATE::Montgomery(modulus);
+            }
+          }
+
+        /**
+         * @returns the modulus this context was constructed with
+         */
+        constexpr const Nat& modulus() const {
+            return _modulus;
+        }
+
+        /**
+         * @returns \f$x \bmod modulus\f$
+         * @note Values with fewer than twice as many digits as the modulus
+         * are reduced without division
+         */
+        constexpr Nat reduce(const Nat& x) const {
+            if (x < _modulus) { return x; }
+            if (x.digit_length() > 2 * _size) { return x % _modulus; }
+            if (_montgomery.size != 0) {
+                // split x = hi·R + lo with both halves < R, then (hi·R²)R⁻¹ + ((lo·R²)R⁻¹)R⁻¹ = x
+                std::size_t shift = _size * DIGIT_BITS;
+                Nat high = x >> shift;
+                Nat low = x - (high << shift);
+                return addmod(
+                    _montgomery.multiply(high, _montgomery.r_squared),
+                    _montgomery.from_montgomery(_montgomery.multiply(low, _montgomery.r_squared))
+                );
+            }
+            // Barrett reduction: estimate the quotient from the top digits, it's at most 2 too small
+            Nat quotient = ((x >> ((_size - 1) * DIGIT_BITS)) * _reciprocal) >> ((_size + 1) * DIGIT_BITS);
+            Nat remainder = x - quotient * _modulus;
+            while (remainder >= _modulus) {
+                remainder -= _modulus;
+            }
+            return remainder;
+        }
+
+        /**
+         * @returns \f$(a + b) \bmod modulus\f$
+         */
+        constexpr Nat addmod(const Nat& a, const Nat& b) const {
+            Nat sum = reduce(a) + reduce(b);
+            if (sum >= _modulus) {
+                sum -= _modulus;
+            }
+            return sum;
+        }
+
+        /**
+         * @returns \f$(a - b) \bmod modulus\f$, which is never negative
+         */
+        constexpr Nat submod(const Nat& a, const Nat& b) const {
+            Nat x = reduce(a);
+            Nat y = reduce(b);
+            if (x >= y) {
+                return x - y;
+            }
+            return _modulus - (y - x);
+        }
+
+        /**
+         * @returns \f$ab \bmod modulus\f$
+         */
+        constexpr Nat mulmod(const Nat& a, const Nat& b) const {
+            if (_montgomery.size != 0) {
+                // (abR⁻¹)R²R⁻¹ = ab, so two Montgomery products need no conversion
+                return _montgomery.multiply(_montgomery.multiply(reduce(a), reduce(b)), _montgomery.r_squared);
+            }
+            return reduce(reduce(a) * reduce(b));
+        }
+
+        /**
+         * @returns \f$a^2 \bmod modulus\f$
+         */
+        constexpr Nat sqrmod(const Nat& a) const {
+            Nat x = reduce(a);
+            return mulmod(x, x);
+        }
+
+        /**
+         * @brief Modular exponentiation, reusing this context's constants
+         * @returns \f$base^{exponent} \bmod context.modulus()\f$
+         * @relates com::saxbophone::arby::ModContext
+         */
+        friend constexpr Nat powmod(const Nat& base, const Nat& exponent, const ModContext& context);
+
+    private:
+        static constexpr std::size_t DIGIT_BITS = std::numeric_limits<Nat::StorageType>::digits;
+
+        Nat _modulus;
+        std::size_t _size; // number of digits in modulus
+        Nat _reciprocal; // Barrett's μ = BASE²ᵏ / modulus
+        PRIVATE::Montgomery _montgomery; // only set up for odd moduli
+    };
+
+    // define and lift scope of powmod() friend from ADL into arby's scope
+    constexpr Nat powmod(const Nat& base, const Nat& exponent, const ModContext& context) {
+        if (context._modulus == 1) { return 0; } // everything is congruent to zero modulo 1
+        if (not exponent) { return 1; }
+        if (context._montgomery.size != 0) {
+            const PRIVATE::Montgomery& montgomery = context._montgomery;
+            Nat result = PRIVATE::sliding_window_pow(
+                montgomery.multiply(context.reduce(base), montgomery.r_squared),
+                exponent,
+                montgomery.to_montgomery(1),
+                [&](const Nat& a, const Nat& b) { return montgomery.multiply(a, b); }
+            );
+            return montgomery.from_montgomery(result);
+        } else {
+            return PRIVATE::sliding_window_pow(
+                context.reduce(base),
+                exponent,
+                1,
+                [&](const Nat& a, const Nat& b) { return context.reduce(a * b); }
+            );
+        }
+    }
+}
+
+#endif // include guard
@@ -24,19 +24,34 @@
 #include <cstdint>
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
 #include <compare>
+#include <concepts>
+#include <filesystem>
+#if __has_include(<format>)
+#include <format>
+#endif
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <random>
+#include <span>
 #include <string>
+#include <string_view>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <codlili/list.hpp>
 
 #include <arby/DivisionResult.hpp>
+#include <arby/GcdResult.hpp>
 #include <arby/Interval.hpp>
+#include <arby/SqrtResult.hpp>
 
 
 /**
@@ -118,9 +133,89 @@ namespace com::saxbophone::arby {
                 return x * exp(x, n - 1);
             }
         }
+
+        // trial division uses every odd prime below this bound
+        constexpr std::size_t SMALL_PRIMES_BOUND = 1024;
+
+        // sieve of Eratosthenes for all values below SMALL_PRIMES_BOUND
+        constexpr std::array<bool, SMALL_PRIMES_BOUND> sieve_small_primes() {
+            std::array<bool, SMALL_PRIMES_BOUND> is_prime = {};
+            for (std::size_t i = 2; i < SMALL_PRIMES_BOUND; i++) {
+                is_prime[i] = true;
+            }
+            for (std::size_t i = 2; i * i < SMALL_PRIMES_BOUND; i++) {
+                if (is_prime[i]) {
+                    for (std::size_t j = i * i; j < SMALL_PRIMES_BOUND; j += i) {
+                        is_prime[j] = false;
+                    }
+                }
+            }
+            return is_prime;
+        }
+
+        constexpr std::array<bool, SMALL_PRIMES_BOUND> SMALL_PRIMES_SIEVE = sieve_small_primes();
+
+        constexpr std::size_t SMALL_PRIMES_COUNT = (std::size_t)std::count(SMALL_PRIMES_SIEVE.begin() + 3, SMALL_PRIMES_SIEVE.end(), true);
+
+        // every odd prime below SMALL_PRIMES_BOUND, in ascending order
+        constexpr std::array<StorageTraits::StorageType, SMALL_PRIMES_COUNT> list_small_primes() {
+            std::array<StorageTraits::StorageType, SMALL_PRIMES_COUNT> primes = {};
+            std::size_t count = 0;
+            for (std::size_t i = 3; i < SMALL_PRIMES_BOUND; i++) {
+                if (SMALL_PRIMES_SIEVE[i]) {
+                    primes[count++] = (StorageTraits::StorageType)i;
+                }
+            }
+            return primes;
+        }
+
+        constexpr std::array<StorageTraits::StorageType, SMALL_PRIMES_COUNT> SMALL_PRIMES = list_small_primes();
+
+        /*
+         * consecutive runs of SMALL_PRIMES whose product fits into a single
+         * digit, so that one pass over the digits finds the residues modulo
+         * all of them at once
+         */
+        struct SmallPrimeBatch {
+            StorageTraits::StorageType product = 1;
+            std::size_t first = 0; // index into SMALL_PRIMES
+            std::size_t last = 0; // one past the end
+        };
+
+        // splits SMALL_PRIMES greedily into batches, writing them to batches if given and returning how many there are
+        constexpr std::size_t batch_small_primes(SmallPrimeBatch* batches = nullptr) {
+            using StorageType = StorageTraits::StorageType;
+            std::size_t count = 0;
+            SmallPrimeBatch batch;
+            for (std::size_t i = 0; i < SMALL_PRIMES_COUNT; i++) {
+                if (batch.product > std::numeric_limits<StorageType>::max() / SMALL_PRIMES[i]) {
+                    if (batches != nullptr) { batches[count] = batch; }
+                    count++;
+                    batch = {1, i, i};
+                }
+                batch.product *= SMALL_PRIMES[i];
+                batch.last = i + 1;
+            }
+            if (batches != nullptr) { batches[count] = batch; }
+            return count + 1;
+        }
+
+        constexpr std::size_t SMALL_PRIME_BATCHES_COUNT = batch_small_primes();
+
+        constexpr std::array<SmallPrimeBatch, SMALL_PRIME_BATCHES_COUNT> list_small_prime_batches() {
+            std::array<SmallPrimeBatch, SMALL_PRIME_BATCHES_COUNT> batches = {};
+            batch_small_primes(batches.data());
+            return batches;
+        }
+
+        constexpr std::array<SmallPrimeBatch, SMALL_PRIME_BATCHES_COUNT> SMALL_PRIME_BATCHES = list_small_prime_batches();
+
+        struct Montgomery;
     }
     // end of PRIVATE
 
+    class Accumulator;
+
     /**
      * @brief Arbitrary-precision unsigned integer type
      * @details This is named after \f$\mathbb{N}\f$, the set of Natural numbers,
@@ -174,6 +269,26 @@ namespace com::saxbophone::arby {
                 _digits.pop_front();
             }
         }
+        // resizes to exactly the given number of digits, adding or removing them at the most significant end
+        constexpr void _resize_digits(std::size_t size) {
+            if (_digits.size() < size) {
+                _digits.push_front(size - _digits.size(), 0);
+            }
+            while (_digits.size() > size) {
+                _digits.pop_front();
+            }
+        }
+        // sets to zero, keeping only one of the existing digits
+        constexpr void _set_zero() {
+            _resize_digits(1);
+            _digits.front() = 0;
+        }
+        // copies the value of other into the existing digits of this, only allocating any extra digits needed
+        constexpr void _assign_digits(const Nat& other) {
+            if (this == &other) { return; }
+            _resize_digits(other._digits.size());
+            std::copy(other._digits.begin(), other._digits.end(), _digits.begin());
+        }
     public:
         /**
          * @brief The number base used internally to store the value
@@ -274,6 +389,10 @@ namespace com::saxbophone::arby {
          * @param value Positive floating point value to initialise with
          * @throws std::domain_error when `value < 0` or when `value` is not a
          * finite number.
+         * @note The value's mantissa is split off with `std::frexp()` and its
+         * bits read out a digit at a time, so only as many floating-point
+         * operations are done as there are digits in the mantissa, no matter
+         * how large the value is, then the result is shifted into place
          */
         static Nat from_float(long double value) {
             // prevent initialising from negative values
@@ -284,25 +403,67 @@ namespace com::saxbophone::arby {
             if (not std::isfinite(value)) {
                 throw std::domain_error("Nat cannot be Infinite or NaN");
             }
-            Nat output;
-            if (value < 1) { return output; } // output is already zero
-            while (value > 0) {
-                StorageType digit = (StorageType)std::fmod(value, Nat::BASE);
-                output._digits.push_front(digit);
-                value /= Nat::BASE;
-                // truncate the fractional part of the floating-point value
-                value = std::trunc(value);
-            }
-            output._digits.pop_back(); // first digit is zero-placeholder, now overwritten
-            output._validate_digits();
+            // value = fraction × 2ᵉˣᵖᵒⁿᵉⁿᵗ, for fraction in [0.5, 1)
+            int exponent;
+            long double fraction = std::frexp(value, &exponent);
+            if (exponent <= 0) { return 0; } // value < 1
+            // read out the fraction's bits, only until either it runs out or the whole part is covered
+            codlili::list<StorageType> digits;
+            std::size_t bits = 0;
+            while (fraction != 0 and bits < (std::size_t)exponent) {
+                fraction = std::ldexp(fraction, BITS_PER_DIGIT);
+                long double whole = std::trunc(fraction);
+                digits.push_back((StorageType)whole);
+                fraction -= whole;
+                bits += BITS_PER_DIGIT;
+            }
+            // the digits hold the leading bits of value, so line them up with its exponent, truncating any fractional bits
+            Nat output = digits;
+            if (bits < (std::size_t)exponent) {
+                output <<= (std::size_t)exponent - bits;
+            } else {
+                output >>= bits - (std::size_t)exponent;
+            }
             return output;
         }
         /**
          * @brief String-constructor, initialises from string decimal value
          * @param digits string containing the digits of the value to initialise
-         * with, written in decimal
+         * with, written in decimal (or hexadecimal or binary, with the same
+         * prefixes as for operator""_nat())
+         * @throws std::invalid_argument when `digits` is empty, or contains
+         * a character that isn't a digit of its base, in which case the
+         * message gives the character and its position
          */
         Nat(std::string digits);
+        /**
+         * @brief Constructor-like static method, creates Nat from raw bytes,
+         * the counterpart of export_bytes()
+         * @param bytes the bytes to read, a whole number of words
+         * @param order whether the bytes are big-endian (most significant
+         * first) or little-endian (least significant first)
+         * @param word_size number of bytes in each word
+         * @returns Nat with the value of the bytes, zero if there are none
+         * @throws std::invalid_argument when `word_size` is zero or doesn't
+         * divide the number of bytes, or `order` is neither big nor little
+         * @note Complexity: @f$ \mathcal{O(n)} @f$. Words are copied a digit at
+         * a time with `std::memcpy()` when the byte order is the native one.
+         */
+        static Nat import_bytes(std::span<const std::byte> bytes, std::endian order = std::endian::big, std::size_t word_size = 1);
+        /**
+         * @brief Constructor-like static method, reads a Nat from a file
+         * written by save()
+         * @details Files written on machines with other digit sizes or byte
+         * orders are read just the same. The file is memory-mapped where the
+         * platform supports it, otherwise read in one go, and its digits
+         * bulk-copied in with import_bytes(), so there's no parsing of digits.
+         * @param path the file to read
+         * @returns Nat with the value stored in the file
+         * @throws std::runtime_error when the file can't be read, or isn't a
+         * valid Nat file (including when its reserved header bytes aren't
+         * zero)
+         */
+        static Nat load(const std::filesystem::path& path);
     private:
         // private helper method to abstract the common part of the casting op
         template <typename T>
@@ -315,6 +476,50 @@ namespace com::saxbophone::arby {
             }
             return accumulator;
         }
+        /*
+         * rounds to the nearest value with no more significant bits than T's
+         * mantissa holds, ties to even, returned as mantissa × 2ˢʰⁱᶠᵗ.
+         * Only the leading digits are read, unless needed to break a tie
+         */
+        template <std::floating_point T>
+        constexpr std::pair<Nat, std::size_t> _round_for() const {
+            constexpr std::size_t MANTISSA = std::numeric_limits<T>::digits;
+            std::size_t length = bit_length();
+            if (length <= MANTISSA) { return {*this, 0}; }
+            // enough digits for the mantissa and the bit below it, even if the leading digit has only one bit
+            constexpr std::size_t LEADING = (MANTISSA + BITS_PER_DIGIT) / BITS_PER_DIGIT + 1;
+            codlili::list<StorageType> leading;
+            auto it = _digits.begin();
+            for (std::size_t i = 0; i < LEADING and it != _digits.end(); i++) {
+                leading.push_back(*it);
+                it++;
+            }
+            Nat head = leading;
+            std::size_t excess = head.bit_length() - (MANTISSA + 1);
+            Nat mantissa = head >> excess;
+            bool round = mantissa._digits.back() & 1;
+            mantissa >>= 1;
+            if (round) {
+                // exactly half-way only if none of the bits below the round bit are set, then round to even
+                bool sticky = (mantissa._digits.back() & 1) or head != ((head >> excess) << excess);
+                for (; not sticky and it != _digits.end(); it++) {
+                    sticky = *it != 0;
+                }
+                if (sticky) {
+                    ++mantissa;
+                }
+            }
+            return {mantissa, length - MANTISSA};
+        }
+        // private helper method for the casts to floating-point types
+        template <std::floating_point T>
+        constexpr T _to_float() const {
+            std::pair<Nat, std::size_t> rounded = _round_for<T>();
+            T mantissa = rounded.first._cast_to<T>();
+            if (rounded.second == 0) { return mantissa; }
+            // exponents too large for int are infinite anyway
+            return std::ldexp(mantissa, (int)std::min(rounded.second, (std::size_t)std::numeric_limits<int>::max()));
+        }
     public:
         /**
          * @returns Value of this Nat object cast to uintmax_t
@@ -329,22 +534,42 @@ namespace com::saxbophone::arby {
             return this->_cast_to<uintmax_t>();
         }
         /**
-         * @returns Value of this Nat object cast to long double
+         * @returns Value of this Nat object cast to long double, correctly rounded
+         * to nearest (ties to even), or infinity if out of its range
+         * @note Only the leading digits are read, except to break exact ties
          */
         explicit constexpr operator long double() const {
-            return this->_cast_to<long double>();
+            return this->_to_float<long double>();
         }
         /**
-         * @returns Value of this Nat object cast to float
+         * @returns Value of this Nat object cast to float, correctly rounded
+         * to nearest (ties to even), or infinity if out of its range
+         * @note Only the leading digits are read, except to break exact ties
          */
         explicit constexpr operator float() const {
-            return this->_cast_to<float>();
+            return this->_to_float<float>();
         }
         /**
-         * @returns Value of this Nat object cast to double
+         * @returns Value of this Nat object cast to double, correctly rounded
+         * to nearest (ties to even), or infinity if out of its range
+         * @note Only the leading digits are read, except to break exact ties
          */
         explicit constexpr operator double() const {
-            return this->_cast_to<double>();
+            return this->_to_float<double>();
+        }
+        /**
+         * @brief Splits the value into a mantissa and exponent, like GMP's
+         * `mpz_get_d_2exp()`, for values that may be beyond the range of double
+         * @returns `{mantissa, exponent}` where this Nat is approximately
+         * \f$mantissa\times2^{exponent}\f$ and \f$0.5\le mantissa<1\f$,
+         * rounded to nearest (ties to even), or `{0.0, 0}` if it's zero
+         * @note Only the leading digits are read, except to break exact ties
+         */
+        std::pair<double, uintmax_t> to_double_2exp() const {
+            if (not *this) { return {0.0, 0}; }
+            auto [mantissa, shift] = _round_for<double>();
+            std::size_t bits = mantissa.bit_length();
+            return {std::ldexp(mantissa._cast_to<double>(), -(int)bits), (uintmax_t)(shift + bits)};
         }
         /**
          * @returns Value of this Nat object cast to any numeric type
@@ -369,9 +594,26 @@ namespace com::saxbophone::arby {
         /**
          * @brief custom ostream operator that allows class Nat to be printed
          * with std::cout and friends
-         * @note Complexity is @f$ \mathcal{O(terrible)} @f$
+         * @details Honours `std::hex` and `std::oct`, otherwise writes decimal
+         * @note Hexadecimal and octal are written in @f$ \mathcal{O(n)} @f$
+         * by regrouping bits, decimal takes a few large divisions
+         * @note Unless a field width is set, decimal is written a block at a
+         * time as generated by decimal_chunks(), without building a string
          */
         friend std::ostream& operator<<(std::ostream& os, const Nat& object);
+        /**
+         * @brief custom istream operator that allows class Nat to be read
+         * with std::cin and friends
+         * @details Honours `std::hex`, `std::oct` and `std::dec`, reading as
+         * many digits of the base as there are (and a leading `0x` or `0X`
+         * in hexadecimal). Digits are handed to a NatParser a buffer at a time
+         * rather than first being collected into one string.
+         * @note As for the built-in types, zero is stored and `failbit` set if
+         * the first character after any whitespace isn't a digit
+         */
+        friend std::istream& operator>>(std::istream& is, Nat& object);
+        // reads the digits directly when the base is a power of two
+        friend std::to_chars_result to_chars(char* first, char* last, const Nat& value, int base);
         /**
          * @returns string representing the value of this Nat, in decimal
          */
@@ -577,67 +819,108 @@ namespace com::saxbophone::arby {
             // optimisation using bitshifting when multiplying by binary powers
             if (rhs.is_power_of_2()) { return lhs << (rhs.bit_length() - 1); }
             if (lhs.is_power_of_2()) { return rhs * lhs; }
-            // multiply each digit from lhs with each digit from rhs
-            std::size_t l = 0; // manual indices to track which digit we are on,
-            std::size_t r = 0; // as codlili's iterators are not random-access
-            for (auto lhs_digit : lhs._digits) {
-                // reset r index as it cycles through multiple times
-                r = 0;
-                for (auto rhs_digit : rhs._digits) {
-                    // cast lhs to OverflowType to make sure both operands get promoted to avoid wrap-around overflow
-                    OverflowType multiplication = (OverflowType)lhs_digit * rhs_digit;
-                    // create a new Nat with this intermediate result and add trailing places as needed
-                    Nat intermediate = multiplication;
-                    // we need to remap the indices as the digits are stored big-endian
-                    std::size_t shift_amount = (lhs._digits.size() - 1 - l) + (rhs._digits.size() - 1 - r);
-                    // add that many trailing zeroes to intermediate's digits
-                    intermediate._digits.push_back(shift_amount, 0);
-                    // finally, add it to lhs as an accumulator
-                    product += intermediate;
-                    // increment manual indices
-                    r++;
-                }
-                l++;
+            // schoolbook multiplication, adding one row for each digit of the shorter operand
+            const Nat& longer = lhs._digits.size() >= rhs._digits.size() ? lhs : rhs;
+            const Nat& shorter = lhs._digits.size() >= rhs._digits.size() ? rhs : lhs;
+            std::size_t offset = 0;
+            for (auto it = shorter._digits.rbegin(); it != shorter._digits.rend(); it++, offset++) {
+                product._add_multiple(longer, *it, offset);
             }
             product._validate_digits();
             return product;
         }
-    private: // private helper methods for divmod() TODO: move to anonymous namespace near definition of divmod()
-        // function that shifts up rhs to be just big enough to be smaller than lhs
-        // TODO: rewrite this to use bit-shifting for speed
-        static constexpr Nat get_max_shift(const Nat& lhs, const Nat& rhs) {
-            // how many places can we shift rhs left until it's the same width as lhs?
-            std::size_t wiggle_room = lhs._digits.size() - rhs._digits.size();
-            // provisionally perform the shift up
-            Nat shift = 1;
-            shift._digits.push_back(wiggle_room, 0);
-            // drag back down wiggle_room while shifted rhs > lhs
-            while (rhs * shift > lhs) {
-                shift._digits.pop_back();
-            }
-            return shift;
-        }
-        // uses leading 1..2 digits of lhs and leading digits of rhs to estimate how many times it goes in
-        static constexpr OverflowType estimate_division(const Nat& lhs, const Nat& rhs) {
-            OverflowType denominator = (OverflowType)rhs._digits.front();
-            // if any of the other digits of rhs are non-zero...
-            if (std::any_of(++rhs._digits.begin(), rhs._digits.end(), [](StorageType digit){ return digit != 0; })) {
-                // increment denominator, we don't know what those other digits are so we have to assume denominator
-                // is closer in value to denominator+1 and estimate accordingly, by deliberately underestimating...
-                denominator++;
-            }
-            if (lhs._digits.front() >= denominator) { // use lhs[0] / rhs[0] only
-                return (OverflowType)lhs._digits.front() / denominator;
-            } else { // use lhs[0..1] / rhs[0]
-                // chop off all but the leading two digits of lhs to get the numerator
-                Nat leading_digits = lhs;
-                // NOTE: we can guarantee that lhs will not be shorter than 2 digits here ONLY because the caller will
-                // not call this method if lhs < rhs AND to get to this branch, the first digit of lhs is less than that
-                // of rhs. These facts taken together prove that lhs is at least 2 digits long at this point.
-                leading_digits._digits.resize(2);
-                OverflowType numerator = (OverflowType)(uintmax_t)leading_digits;
-                return (numerator / denominator);
+    private: // private helper methods for divmod()
+        /*
+         * long division by Knuth's Algorithm D (TAOCP Vol. 2, §4.3.1), which
+         * finds one quotient digit per pass from the leading digits alone.
+         * quotient and remainder must not alias lhs, rhs or each other, and
+         * rhs must be non-zero
+         */
+        static constexpr void _long_divide(Nat& quotient, Nat& remainder, const Nat& lhs, const Nat& rhs) {
+            if (lhs < rhs) {
+                quotient._set_zero();
+                remainder._assign_digits(lhs);
+                return;
+            }
+            std::size_t n = rhs._digits.size();
+            if (n == 1) {
+                // short division, in a single pass down from the most significant digit
+                OverflowType divisor = rhs._digits.front();
+                quotient._resize_digits(lhs._digits.size());
+                OverflowType carry = 0;
+                auto it = quotient._digits.begin();
+                for (auto digit : lhs._digits) {
+                    OverflowType current = (carry << BITS_PER_DIGIT) | digit;
+                    *it = (StorageType)(current / divisor);
+                    carry = current % divisor;
+                    it++;
+                }
+                quotient._remove_leading_zeroes();
+                remainder._set_zero();
+                remainder._digits.front() = (StorageType)carry;
+                return;
+            }
+            // normalise so that the divisor's leading digit has its top bit set, which keeps estimates within 2
+            auto shift = (uintmax_t)std::countl_zero(rhs._digits.front());
+            Nat divisor = rhs << shift;
+            remainder._assign_digits(lhs);
+            remainder <<= shift;
+            OverflowType leading = divisor._digits.front();
+            OverflowType second = *++divisor._digits.begin();
+            // the dividend gets a leading digit beyond those of lhs even if zero, and keeps all of them until the end
+            std::size_t places = lhs._digits.size() - n + 1;
+            remainder._resize_digits(lhs._digits.size() + 1);
+            quotient._resize_digits(places);
+            // each pass works on a window of n + 1 digits, from top (worth BASEʲ⁺ⁿ) down to bottom (worth BASEʲ)
+            auto top = remainder._digits.begin();
+            auto bottom = top;
+            for (std::size_t i = 0; i < n; i++) {
+                bottom++;
+            }
+            auto it = quotient._digits.begin();
+            for (std::size_t j = places; j-- > 0; top++, bottom++, it++) {
+                // estimate from the leading two digits, then refine with the third, leaving it at most one too big
+                auto window = top;
+                OverflowType first = *window;
+                window++;
+                OverflowType numerator = (first << BITS_PER_DIGIT) | *window;
+                window++;
+                OverflowType third = *window;
+                OverflowType estimate = numerator / leading;
+                OverflowType rest = numerator % leading;
+                while (estimate >= BASE or estimate * second > ((rest << BITS_PER_DIGIT) | third)) {
+                    estimate--;
+                    rest += leading;
+                    if (rest >= BASE) { break; }
+                }
+                // subtract estimate × divisor from the window, working up from its least significant digit
+                OverflowType borrow = 0;
+                window = bottom;
+                for (auto digit = divisor._digits.rbegin(); digit != divisor._digits.rend(); digit++, window--) {
+                    OverflowType product = (OverflowType)*digit * estimate + borrow;
+                    StorageType low = (StorageType)product;
+                    borrow = (product >> BITS_PER_DIGIT) + (*window < low);
+                    *window -= low;
+                }
+                bool negative = *window < borrow;
+                *window -= (StorageType)borrow;
+                if (negative) {
+                    // one too many, so add the divisor back, which carries out exactly the wrapped-around amount
+                    OverflowType carry = 0;
+                    window = bottom;
+                    for (auto digit = divisor._digits.rbegin(); digit != divisor._digits.rend(); digit++, window--) {
+                        OverflowType sum = (OverflowType)*window + *digit + carry;
+                        *window = (StorageType)sum;
+                        carry = sum >> BITS_PER_DIGIT;
+                    }
+                    *window += (StorageType)carry;
+                    estimate--;
+                }
+                *it = (StorageType)estimate;
             }
+            quotient._remove_leading_zeroes();
+            remainder._remove_leading_zeroes();
+            remainder >>= shift;
         }
     public:
         /**
@@ -645,9 +928,23 @@ namespace com::saxbophone::arby {
          * @param lhs,rhs operands for the division/modulo operation
          * @returns DivisionResult of {quotient, remainder}
          * @throws std::domain_error when rhs is zero
-         * @todo Work out time-complexity
+         * @note Complexity: @f$ \mathcal{O(nm)} @f$
          */
         friend constexpr DivisionResult<Nat> divmod(const Nat& lhs, const Nat& rhs);
+        /**
+         * @brief division and modulo, writing the results into existing objects
+         * @details Uses Knuth's long division algorithm (Algorithm D), with the
+         * digits of `quotient` and `remainder` being reused where possible
+         * @param[out] quotient,remainder where to write the results, which must
+         * be different objects
+         * @param lhs,rhs operands for the division/modulo operation, which may
+         * be the same objects as `quotient` or `remainder`
+         * @throws std::domain_error when rhs is zero
+         * @throws std::invalid_argument when quotient and remainder are the
+         * same object
+         * @note Complexity: @f$ \mathcal{O(nm)} @f$
+         */
+        friend constexpr void divmod(Nat& quotient, Nat& remainder, const Nat& lhs, const Nat& rhs);
         /**
          * @brief division-assignment
          * @details Divides this Nat by other value and stores result to this
@@ -823,6 +1120,8 @@ namespace com::saxbophone::arby {
          * @note Complexity: @f$ \mathcal{O(n)} @f$
          */
         constexpr Nat& operator<<=(uintmax_t n) {
+            // zero stays zero, no matter how far it's shifted
+            if (_digits.size() == 1 and _digits.front() == 0) { return *this; }
             // break the shift up into whole-digit and part-digit shifts
             auto wholes = n / BITS_PER_DIGIT;
             auto parts = n % BITS_PER_DIGIT;
@@ -943,6 +1242,58 @@ namespace com::saxbophone::arby {
             bits_for_digits -= (sizeof(StorageType) * 8 - leading_occupancy);
             return bits_for_digits;
         }
+        /**
+         * @returns An upper bound on the number of characters needed to write
+         * this number in the given base, e.g. with to_chars()
+         * @details This is never more than one or two characters over the
+         * exact amount, so it's suitable for sizing buffers up front
+         * @param base number base to write in, from 2 to 36
+         * @throws std::invalid_argument when base is out of range
+         */
+        std::size_t chars_needed(int base = 10) const;
+        /**
+         * @brief Writes the value as raw bytes, like GMP's `mpz_export()`
+         * @details Exactly \f$\lceil\frac{byte\_length()}{word\_size}\rceil\f$
+         * words are written to the start of `bytes`, padded with zeroes at the
+         * most significant end. The same byte order is used both for the order
+         * of the words and the bytes within each one, so the output is always
+         * the value's plain big or little-endian representation.
+         * @param[out] bytes where to write the value
+         * @param order whether to write big-endian (most significant first) or
+         * little-endian (least significant first)
+         * @param word_size number of bytes in each word
+         * @returns The number of bytes written
+         * @throws std::invalid_argument when `word_size` is zero or `order` is
+         * neither big nor little
+         * @throws std::length_error when `bytes` is too small to hold them
+         * @note Complexity: @f$ \mathcal{O(n)} @f$. Digits are copied whole with
+         * `std::memcpy()` when the byte order is the native one.
+         */
+        std::size_t export_bytes(std::span<std::byte> bytes, std::endian order = std::endian::big, std::size_t word_size = 1) const;
+        /**
+         * @brief Writes the value to a file in a compact binary format, which
+         * load() reads back
+         * @details The file is a 24-byte header followed by the digits:
+         * | offset | size | contents |
+         * | ------ | ---- | -------- |
+         * | 0      | 8    | `arby:Nat` |
+         * | 8      | 1    | format version, 1 |
+         * | 9      | 1    | bytes per digit |
+         * | 10     | 1    | byte order, 0 for little-endian or 1 for big-endian |
+         * | 11     | 5    | reserved, must be zeroes |
+         * | 16     | 8    | number of digits, little-endian |
+         *
+         * The digits follow in the same order as the bytes within them, i.e.
+         * they are the value's plain big or little-endian representation.
+         * save() always writes digits of the native size and byte order, so
+         * that each one is a single copy straight from memory.
+         * @param path the file to write, replacing any that exists
+         * @throws std::runtime_error when the file can't be written
+         * @note The value is first written to `path` with `.tmp` appended,
+         * which is then renamed over `path`, so a failed save leaves any
+         * existing file as it was.
+         */
+        void save(const std::filesystem::path& path) const;
         /**
          * @returns a copy of the underlying digits that make up this Nat value
          */
@@ -965,11 +1316,386 @@ namespace com::saxbophone::arby {
          * - \f$log_b(x)\in\mathbb{N}\f$
          * @remarks Otherwise:
          * - \f$log_b(x)\in\mathbb{R}\f$
-         * @note Complexity: @f$ \mathcal{O}(n^2log(n)) @f$
+         * @note For bases which are powers of 2, and otherwise whenever
+         * \f$log_b(x)\f$ is not extremely close to a whole number, the result
+         * is found from the leading digits of `base` and `x` alone, in
+         * @f$ \mathcal{O(1)} @f$. In the remaining cases, one call to ipow()
+         * is needed to settle the answer.
          * @relates com::saxbophone::arby::Nat
          */
         friend constexpr Interval<uintmax_t> ilog(const Nat& base, const Nat& x);
+        /**
+         * @brief Checks whether `x` is the square of some whole number
+         * @details Most non-squares are rejected cheaply by checking whether
+         * `x` modulo 64, 63, 65 and 11 is a quadratic residue, before falling
+         * back to calculating the square root
+         * @returns `true` if \f$\sqrt{x}\in\mathbb{N}\f$, otherwise `false`
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr bool is_perfect_square(const Nat& x);
+        /**
+         * @brief Greatest common divisor
+         * @details Uses Lehmer's algorithm, which replaces most of the
+         * divisions of Euclid's algorithm with a few steps carried out on the
+         * leading digits alone, finishing off with binary GCD once both values
+         * fit into uintmax_t
+         * @returns The largest value which divides both `a` and `b`
+         * @note \f$\gcd(a, 0)=a\f$ and \f$\gcd(0, 0)=0\f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr Nat gcd(const Nat& a, const Nat& b);
+        /**
+         * @brief Extended greatest common divisor
+         * @details Uses the same algorithm as gcd(), additionally keeping
+         * track of the coefficients
+         * @returns GcdResult holding \f$g=\gcd(a,b)\f$ and coefficients
+         * \f$x\f$ and \f$y\f$ such that \f$ax-by=g\f$, where
+         * \f$x\leq\frac{b}{g}\f$ and \f$y\leq\frac{a}{g}\f$
+         * @throws std::domain_error when `a` is zero but `b` isn't, as no such
+         * coefficients exist
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr GcdResult<Nat> gcdext(const Nat& a, const Nat& b);
+        /**
+         * @brief Tests whether `n` is prime
+         * @details Trial division by every odd prime below 1024 rejects most
+         * composites with a few passes over the digits, after which the
+         * Baillie-PSW test is applied: a Miller-Rabin test to base 2 followed
+         * by a strong Lucas test with Selfridge's parameters, both using
+         * Montgomery multiplication
+         * @param n value to test
+         * @param rounds number of additional Miller-Rabin tests to apply,
+         * using the odd primes in turn as bases
+         * @returns `false` if `n` is definitely composite, `true` if `n` is
+         * prime or is a Baillie-PSW pseudoprime
+         * @note No Baillie-PSW pseudoprime is known to exist, and there are
+         * none below \f$2^{64}\f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr bool is_probable_prime(const Nat& n, std::size_t rounds);
+        /**
+         * @brief Finds the next prime after `n`
+         * @details Candidates are sieved by keeping track of their residues
+         * modulo the small primes as the search moves along, only those which
+         * survive get tested with is_probable_prime()
+         * @returns The smallest (probable) prime greater than `n`
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr Nat next_prime(const Nat& n);
+        /**
+         * @brief Uniformly random value of up to the given number of bits
+         * @param generator any type satisfying UniformRandomBitGenerator,
+         * such as `std::mt19937`
+         * @param bits number of random bits to generate
+         * @returns Value in the range \f$[0, 2^{bits})\f$
+         * @note Each digit is generated in place, so the result is the only
+         * allocation
+         * @relates com::saxbophone::arby::Nat
+         */
+        template <typename Generator>
+        friend Nat random_bits(Generator& generator, std::size_t bits);
+        /**
+         * @brief Uniformly random value below the given bound
+         * @param generator any type satisfying UniformRandomBitGenerator,
+         * such as `std::mt19937`
+         * @param bound value which the result is to be less than
+         * @returns Value in the range \f$[0, bound)\f$
+         * @details Digits are generated from the most significant down, with
+         * the leading one limited to the range of the bound's leading digit.
+         * Values are only rejected if they are still level with the bound
+         * when a digit comes out larger than the bound's, so retries are rare.
+         * @throws std::domain_error when bound is zero
+         * @relates com::saxbophone::arby::Nat
+         */
+        template <typename Generator>
+        friend Nat random_below(Generator& generator, const Nat& bound);
+        /**
+         * @brief Fused multiply-add, \f$acc \gets acc + ab\f$
+         * @details The product is added straight into the digits of `acc` one
+         * row at a time, with no temporary holding the product
+         * @note Any of the arguments may refer to the same object
+         * @note Complexity: @f$ \mathcal{O(nm)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void addmul(Nat& acc, const Nat& a, const Nat& b);
+        /**
+         * @brief Fused multiply-subtract, \f$acc \gets acc - ab\f$
+         * @details The product is subtracted straight from the digits of `acc`
+         * one row at a time, with no temporary holding the product
+         * @throws std::underflow_error when \f$ab>acc\f$, in which case `acc`
+         * is left unchanged
+         * @note Any of the arguments may refer to the same object
+         * @note Complexity: @f$ \mathcal{O(nm)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void submul(Nat& acc, const Nat& a, const Nat& b);
+        /**
+         * @brief Fused multiply-add by a scalar, \f$acc \gets acc + ak\f$
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void addmul_ui(Nat& acc, const Nat& a, uintmax_t k);
+        /**
+         * @brief Fused multiply-subtract by a scalar, \f$acc \gets acc - ak\f$
+         * @throws std::underflow_error when \f$ak>acc\f$, in which case `acc`
+         * is left unchanged
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void submul_ui(Nat& acc, const Nat& a, uintmax_t k);
+        /**
+         * @brief Addition into an existing object, \f$out \gets a + b\f$
+         * @details This and the other three-operand functions below write
+         * their result into the digits `out` already has, only allocating
+         * when it needs more of them
+         * @note `out` may be the same object as either or both operands
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void add(Nat& out, const Nat& a, const Nat& b);
+        /**
+         * @brief Subtraction into an existing object, \f$out \gets a - b\f$
+         * @throws std::underflow_error when b is bigger than a, in which case
+         * `out` is left unchanged
+         * @note `out` may be the same object as either or both operands
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void sub(Nat& out, const Nat& a, const Nat& b);
+        /**
+         * @brief Multiplication into an existing object, \f$out \gets ab\f$
+         * @note `out` may be the same object as either or both operands, but
+         * then a copy of it has to be taken
+         * @note Complexity: @f$ \mathcal{O(nm)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void mul(Nat& out, const Nat& a, const Nat& b);
+        /**
+         * @brief Left bit-shift into an existing object, \f$out \gets a \ll n\f$
+         * @note `out` may be the same object as `a`
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void shl(Nat& out, const Nat& a, uintmax_t n);
+        /**
+         * @brief Right bit-shift into an existing object, \f$out \gets a \gg n\f$
+         * @note `out` may be the same object as `a`
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void shr(Nat& out, const Nat& a, uintmax_t n);
+        /**
+         * @brief Bitwise AND into an existing object
+         * @note `out` may be the same object as either or both operands
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void and_(Nat& out, const Nat& a, const Nat& b);
+        /**
+         * @brief Bitwise OR into an existing object
+         * @note `out` may be the same object as either or both operands
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void or_(Nat& out, const Nat& a, const Nat& b);
+        /**
+         * @brief Bitwise XOR into an existing object
+         * @note `out` may be the same object as either or both operands
+         * @note Complexity: @f$ \mathcal{O(n)} @f$
+         * @relates com::saxbophone::arby::Nat
+         */
+        friend constexpr void xor_(Nat& out, const Nat& a, const Nat& b);
     private:
+        // approximates log₂ of this (which must be non-zero) using only the leading digits
+        long double _approximate_log2() const {
+            // three digits always give us at least as many bits as long double can hold
+            long double leading = 0;
+            std::size_t used = 0;
+            for (auto it = _digits.begin(); it != _digits.end() and used < 3; it++, used++) {
+                leading = leading * Nat::BASE + *it;
+            }
+            return std::log2(leading) + (long double)((_digits.size() - used) * BITS_PER_DIGIT);
+        }
+        // returns remainder of division by a single digit, in one pass over the digits
+        constexpr StorageType _remainder_by_digit(StorageType divisor) const {
+            OverflowType remainder = 0;
+            for (auto digit : _digits) {
+                remainder = ((remainder << BITS_PER_DIGIT) | digit) % divisor;
+            }
+            return (StorageType)remainder;
+        }
+        // adds rhs × factor × BASEᵒᶠᶠˢᵉᵗ to this, in a single pass over the digits with no temporaries
+        constexpr void _add_multiple(const Nat& rhs, StorageType factor, std::size_t offset = 0) {
+            if (factor == 0) { return; }
+            // make room for every digit of the product, trimmed again at the end
+            if (_digits.size() <= rhs._digits.size() + offset) {
+                _digits.push_front(rhs._digits.size() + offset + 1 - _digits.size(), 0);
+            }
+            _accumulate_row(rhs, factor, offset);
+            _remove_leading_zeroes();
+            _validate_digits();
+        }
+        // the addition itself for _add_multiple(), for callers which have made room for it and will trim afterwards
+        constexpr void _accumulate_row(const Nat& rhs, StorageType factor, std::size_t offset) {
+            auto it = _digits.rbegin();
+            for (std::size_t i = 0; i < offset; i++) {
+                it++;
+            }
+            // (BASE-1)² + 2(BASE-1) = BASE² - 1, so each step always fits in OverflowType
+            OverflowType carry = 0;
+            for (auto rhs_it = rhs._digits.rbegin(); rhs_it != rhs._digits.rend(); rhs_it++, it++) {
+                OverflowType sum = (OverflowType)*rhs_it * factor + *it + carry;
+                *it = (StorageType)sum;
+                carry = sum >> BITS_PER_DIGIT;
+            }
+            // ripple the carry through the remaining digits
+            for (; carry != 0; it++) {
+                if (it == _digits.rend()) {
+                    _digits.push_front((StorageType)carry);
+                    break;
+                }
+                OverflowType sum = (OverflowType)*it + carry;
+                *it = (StorageType)sum;
+                carry = sum >> BITS_PER_DIGIT;
+            }
+        }
+        // writes operation(a, b) into the existing digits of out one digit at a time, with missing digits as zero
+        template <typename Operation>
+        static constexpr void _combine_digits(Nat& out, const Nat& a, const Nat& b, std::size_t size, Operation operation) {
+            // when out aliases an operand, this only adds leading zeroes or removes digits the result doesn't depend on
+            out._resize_digits(size);
+            auto a_it = a._digits.rbegin();
+            auto b_it = b._digits.rbegin();
+            for (auto it = out._digits.rbegin(); it != out._digits.rend(); it++) {
+                StorageType x = 0;
+                StorageType y = 0;
+                if (a_it != a._digits.rend()) {
+                    x = *a_it;
+                    a_it++;
+                }
+                if (b_it != b._digits.rend()) {
+                    y = *b_it;
+                    b_it++;
+                }
+                *it = operation(x, y);
+            }
+            out._remove_leading_zeroes();
+            out._validate_digits();
+        }
+        /*
+         * subtracts rhs × factor × BASEᵒᶠᶠˢᵉᵗ from this, in a single pass over
+         * the digits with no temporaries. Returns true on underflow, in which
+         * case this is left holding the result modulo BASEⁿ, where n is its
+         * number of digits (which is always more than those of the product)
+         */
+        constexpr bool _subtract_multiple(const Nat& rhs, StorageType factor, std::size_t offset = 0) {
+            if (factor == 0) { return false; }
+            if (_digits.size() <= rhs._digits.size() + offset) {
+                _digits.push_front(rhs._digits.size() + offset + 1 - _digits.size(), 0);
+            }
+            auto it = _digits.rbegin();
+            for (std::size_t i = 0; i < offset; i++) {
+                it++;
+            }
+            // (BASE-1)² + BASE < BASE², so the amount still to subtract always fits in OverflowType
+            OverflowType borrow = 0;
+            for (auto rhs_it = rhs._digits.rbegin(); rhs_it != rhs._digits.rend(); rhs_it++, it++) {
+                OverflowType product = (OverflowType)*rhs_it * factor + borrow;
+                StorageType low = (StorageType)product;
+                borrow = (product >> BITS_PER_DIGIT) + (*it < low);
+                *it -= low; // wraps around when borrowing
+            }
+            // ripple the borrow through the remaining digits
+            for (; borrow != 0 and it != _digits.rend(); it++) {
+                StorageType low = (StorageType)borrow;
+                borrow = *it < low;
+                *it -= low;
+            }
+            if (borrow != 0) { return true; }
+            _remove_leading_zeroes();
+            _validate_digits();
+            return false;
+        }
+        // adds or subtracts a × b to or from acc, one row for each digit of b, with a and b not aliasing acc
+        static constexpr void _multiply_accumulate(Nat& acc, const Nat& a, const Nat& b, bool subtract) {
+            std::size_t offset = 0;
+            for (auto it = b._digits.rbegin(); it != b._digits.rend(); it++, offset++) {
+                if (not subtract) {
+                    acc._add_multiple(a, *it, offset);
+                } else if (acc._subtract_multiple(a, *it, offset)) {
+                    // add back every row so far, leaving acc + BASEⁿ due to the wrap-around
+                    std::size_t wrapped = acc._digits.size();
+                    std::size_t restore = 0;
+                    for (auto row = b._digits.rbegin(); restore <= offset; row++, restore++) {
+                        acc._add_multiple(a, *row, restore);
+                    }
+                    if (acc._digits.size() != wrapped + 1 or acc._digits.front() != 1) {
+                        throw std::logic_error("failed to restore accumulator after underflow");
+                    }
+                    acc._digits.pop_front();
+                    acc._remove_leading_zeroes();
+                    throw std::underflow_error("arithmetic underflow: product bigger than accumulator");
+                }
+            }
+        }
+        // as above, copying whichever operands alias acc
+        static constexpr void _multiply_accumulate_aliased(Nat& acc, const Nat& a, const Nat& b, bool subtract) {
+            if (&acc == &a or &acc == &b) {
+                Nat copy = acc;
+                _multiply_accumulate(acc, &acc == &a ? copy : a, &acc == &b ? copy : b, subtract);
+            } else {
+                _multiply_accumulate(acc, a, b, subtract);
+            }
+        }
+        // divides this by BASE, discarding the least significant digit
+        constexpr void _drop_last_digit() {
+            if (_digits.size() == 1) {
+                _digits.front() = 0;
+            } else {
+                _digits.pop_back();
+            }
+        }
+
+        // returns a × x + b × y, in a single pass over the digits of each
+        static constexpr Nat _sum_of_multiples(const Nat& a, StorageType x, const Nat& b, StorageType y) {
+            Nat sum;
+            sum._add_multiple(a, x);
+            sum._add_multiple(b, y);
+            return sum;
+        }
+        // returns a × x + b × y, where x and y are of opposite sign and the result is known to be non-negative
+        static constexpr Nat _signed_combination(const Nat& a, std::int64_t x, const Nat& b, std::int64_t y) {
+            // each product is a single pass over its own operand, and the difference is taken in place
+            Nat positive;
+            Nat negative;
+            if (y <= 0) {
+                positive._add_multiple(a, (StorageType)x);
+                negative._add_multiple(b, (StorageType)-y);
+            } else {
+                positive._add_multiple(b, (StorageType)y);
+                negative._add_multiple(a, (StorageType)-x);
+            }
+            positive -= std::move(negative);
+            return positive;
+        }
+
+        // returns this modulo each of PRIVATE::SMALL_PRIMES, with one pass over the digits per batch of them
+        constexpr std::array<StorageType, PRIVATE::SMALL_PRIMES_COUNT> _small_prime_residues() const {
+            std::array<StorageType, PRIVATE::SMALL_PRIMES_COUNT> residues = {};
+            for (const auto& batch : PRIVATE::SMALL_PRIME_BATCHES) {
+                StorageType remainder = _remainder_by_digit(batch.product);
+                for (std::size_t i = batch.first; i < batch.last; i++) {
+                    residues[i] = remainder % PRIVATE::SMALL_PRIMES[i];
+                }
+            }
+            return residues;
+        }
+        // Baillie-PSW test (plus extra Miller-Rabin rounds) for odd values with no small factors
+        constexpr bool _is_bpsw_probable_prime(std::size_t rounds) const;
+
+        friend struct PRIVATE::Montgomery;
+        friend class Accumulator;
+
         std::string _stringify_for_base(std::uint8_t base) const;
 
         codlili::list<StorageType> _digits;
@@ -980,53 +1706,212 @@ namespace com::saxbophone::arby {
      * @{
      */
 
+    // define and lift scope of addmul() friend from ADL into arby's scope
+    constexpr void addmul(Nat& acc, const Nat& a, const Nat& b) {
+        // fewer, longer rows are cheaper to add
+        if (a._digits.size() >= b._digits.size()) {
+            Nat::_multiply_accumulate_aliased(acc, a, b, false);
+        } else {
+            Nat::_multiply_accumulate_aliased(acc, b, a, false);
+        }
+    }
+
+    // define and lift scope of submul() friend from ADL into arby's scope
+    constexpr void submul(Nat& acc, const Nat& a, const Nat& b) {
+        if (a._digits.size() >= b._digits.size()) {
+            Nat::_multiply_accumulate_aliased(acc, a, b, true);
+        } else {
+            Nat::_multiply_accumulate_aliased(acc, b, a, true);
+        }
+    }
+
+    // define and lift scope of addmul_ui() friend from ADL into arby's scope
+    constexpr void addmul_ui(Nat& acc, const Nat& a, uintmax_t k) {
+        Nat::_multiply_accumulate_aliased(acc, a, k, false);
+    }
+
+    // define and lift scope of submul_ui() friend from ADL into arby's scope
+    constexpr void submul_ui(Nat& acc, const Nat& a, uintmax_t k) {
+        Nat::_multiply_accumulate_aliased(acc, a, k, true);
+    }
+
+    // define and lift scope of add() friend from ADL into arby's scope
+    constexpr void add(Nat& out, const Nat& a, const Nat& b) {
+        // when out aliases an operand, this only gives it leading zeroes, which don't change its value
+        out._resize_digits(std::max(a._digits.size(), b._digits.size()));
+        auto a_it = a._digits.rbegin();
+        auto b_it = b._digits.rbegin();
+        Nat::OverflowType carry = 0;
+        for (auto it = out._digits.rbegin(); it != out._digits.rend(); it++) {
+            Nat::OverflowType sum = carry;
+            if (a_it != a._digits.rend()) {
+                sum += *a_it;
+                a_it++;
+            }
+            if (b_it != b._digits.rend()) {
+                sum += *b_it;
+                b_it++;
+            }
+            *it = (Nat::StorageType)sum;
+            carry = sum >> Nat::BITS_PER_DIGIT;
+        }
+        if (carry != 0) {
+            out._digits.push_front((Nat::StorageType)carry);
+        }
+        out._remove_leading_zeroes();
+        out._validate_digits();
+    }
+
+    // define and lift scope of sub() friend from ADL into arby's scope
+    constexpr void sub(Nat& out, const Nat& a, const Nat& b) {
+        if (a < b) {
+            throw std::underflow_error("arithmetic underflow: subtrahend bigger than minuend");
+        }
+        // b is no longer than a, so if out aliases it, it only gains leading zeroes
+        out._resize_digits(a._digits.size());
+        auto a_it = a._digits.rbegin();
+        auto b_it = b._digits.rbegin();
+        bool borrow = false;
+        for (auto it = out._digits.rbegin(); it != out._digits.rend(); it++, a_it++) {
+            Nat::OverflowType subtraction = (Nat::OverflowType)*a_it - borrow;
+            if (b_it != b._digits.rend()) {
+                subtraction -= *b_it;
+                b_it++;
+            }
+            *it = (Nat::StorageType)subtraction;
+            borrow = subtraction > std::numeric_limits<Nat::StorageType>::max();
+        }
+        out._remove_leading_zeroes();
+        out._validate_digits();
+    }
+
+    // define and lift scope of mul() friend from ADL into arby's scope
+    constexpr void mul(Nat& out, const Nat& a, const Nat& b) {
+        if (&out == &a or &out == &b) {
+            // the product can't be built up over the top of one of its own operands
+            Nat copy = out;
+            mul(out, &out == &a ? copy : a, &out == &b ? copy : b);
+            return;
+        }
+        if (not a or not b) {
+            out._set_zero();
+            return;
+        }
+        const Nat& longer = a._digits.size() >= b._digits.size() ? a : b;
+        const Nat& shorter = a._digits.size() >= b._digits.size() ? b : a;
+        // the product has at most as many digits as both operands together, so no row ever needs to grow out
+        out._resize_digits(longer._digits.size() + shorter._digits.size());
+        std::fill(out._digits.begin(), out._digits.end(), 0);
+        std::size_t offset = 0;
+        for (auto it = shorter._digits.rbegin(); it != shorter._digits.rend(); it++, offset++) {
+            out._accumulate_row(longer, *it, offset);
+        }
+        out._remove_leading_zeroes();
+        out._validate_digits();
+    }
+
+    // define and lift scope of shl() friend from ADL into arby's scope
+    constexpr void shl(Nat& out, const Nat& a, uintmax_t n) {
+        if (&out == &a) {
+            out <<= n;
+            return;
+        }
+        std::size_t wholes = (std::size_t)(n / Nat::BITS_PER_DIGIT);
+        auto parts = n % Nat::BITS_PER_DIGIT;
+        // room for one more digit than needed, for the bits shifted out of the leading digit
+        out._resize_digits(a._digits.size() + wholes + 1);
+        auto it = out._digits.rbegin();
+        for (std::size_t i = 0; i < wholes; i++, it++) {
+            *it = 0;
+        }
+        Nat::OverflowType carry = 0;
+        for (auto a_it = a._digits.rbegin(); a_it != a._digits.rend(); a_it++, it++) {
+            Nat::OverflowType bucket = ((Nat::OverflowType)*a_it << parts) | carry;
+            *it = (Nat::StorageType)bucket;
+            carry = bucket >> Nat::BITS_PER_DIGIT;
+        }
+        *it = (Nat::StorageType)carry;
+        out._remove_leading_zeroes();
+        out._validate_digits();
+    }
+
+    // define and lift scope of shr() friend from ADL into arby's scope
+    constexpr void shr(Nat& out, const Nat& a, uintmax_t n) {
+        if (&out == &a) {
+            out >>= n;
+            return;
+        }
+        if (n >= a.bit_length()) {
+            out._set_zero();
+            return;
+        }
+        std::size_t wholes = (std::size_t)(n / Nat::BITS_PER_DIGIT);
+        auto parts = n % Nat::BITS_PER_DIGIT;
+        out._resize_digits(a._digits.size() - wholes);
+        auto a_it = a._digits.rbegin();
+        for (std::size_t i = 0; i < wholes; i++) {
+            a_it++;
+        }
+        for (auto it = out._digits.rbegin(); it != out._digits.rend(); it++) {
+            Nat::OverflowType low = *a_it;
+            a_it++;
+            Nat::OverflowType high = a_it != a._digits.rend() ? *a_it : 0;
+            *it = (Nat::StorageType)(((high << Nat::BITS_PER_DIGIT) | low) >> parts);
+        }
+        out._remove_leading_zeroes();
+        out._validate_digits();
+    }
+
+    // define and lift scope of and_() friend from ADL into arby's scope
+    constexpr void and_(Nat& out, const Nat& a, const Nat& b) {
+        Nat::_combine_digits(
+            out, a, b, std::min(a._digits.size(), b._digits.size()),
+            [](Nat::StorageType x, Nat::StorageType y) { return (Nat::StorageType)(x & y); }
+        );
+    }
+
+    // define and lift scope of or_() friend from ADL into arby's scope
+    constexpr void or_(Nat& out, const Nat& a, const Nat& b) {
+        Nat::_combine_digits(
+            out, a, b, std::max(a._digits.size(), b._digits.size()),
+            [](Nat::StorageType x, Nat::StorageType y) { return (Nat::StorageType)(x | y); }
+        );
+    }
+
+    // define and lift scope of xor_() friend from ADL into arby's scope
+    constexpr void xor_(Nat& out, const Nat& a, const Nat& b) {
+        Nat::_combine_digits(
+            out, a, b, std::max(a._digits.size(), b._digits.size()),
+            [](Nat::StorageType x, Nat::StorageType y) { return (Nat::StorageType)(x ^ y); }
+        );
+    }
+
     // define and lift scope of divmod() friend from ADL into arby's scope
-    constexpr DivisionResult<Nat> divmod(const Nat& lhs, const Nat& rhs) {
+    constexpr void divmod(Nat& quotient, Nat& remainder, const Nat& lhs, const Nat& rhs) {
         // division by zero is undefined
         if (rhs._digits.front() == 0) {
             throw std::domain_error("division by zero");
         }
-        if (lhs._digits.front() == 0) { return {lhs, lhs}; } // zero shortcut
-        // optimisation using bitshifting when dividing by binary powers
-        if (rhs.is_power_of_2()) {
-            auto width = rhs.bit_length();
-            // the remainder is the digits that are shifted out, so bitmask for them
-            auto bitmask = (Nat(1) << (width - 1)) - 1;
-            Nat quotient = lhs >> (width - 1);
-            Nat remainder = lhs & bitmask;
-            quotient._validate_digits();
-            remainder._validate_digits();
-            return {quotient, remainder};
-        }
-        // this will gradually accumulate the calculated quotient
-        Nat quotient;
-        // this will gradually decrement with each subtraction
-        Nat remainder = lhs;
-        // while we have any chance in subtracting further from it
-        while (remainder >= rhs) {
-            // exponent denotes a raw value describing how many places we can shift rhs up by
-            Nat exponent = Nat::get_max_shift(remainder, rhs);
-            // estimate how many times it goes in and subtract this many of rhs
-            Nat estimate = Nat::estimate_division(remainder, rhs);
-            // we'll actually be subtracting rhs shifted by exponent
-            Nat shifted_rhs = rhs * exponent;
-            if (remainder >= (estimate * shifted_rhs)) {
-                remainder -= estimate * shifted_rhs;
-                quotient += estimate * exponent;
-            }
-            // our estimate deliberately underestimates how many times shifted rhs can go into remainder
-            // here we subtract further rounds of shifted_rhs if possible
-            if (remainder >= (shifted_rhs)) {
-                remainder -= (shifted_rhs);
-                quotient += exponent;
-            }
-            // NOTE: this is guaranteed to terminate eventually because the last value that shifted_rhs will take
-            // will be rhs without a shift, i.e. rhs * 1, subtraction of which from the remainder is guaranteed to
-            // terminate.
+        if (&quotient == &remainder) {
+            throw std::invalid_argument("divmod: quotient and remainder must be different objects");
+        }
+        if (&quotient == &lhs or &quotient == &rhs or &remainder == &lhs or &remainder == &rhs) {
+            // the outputs are written to while the operands are still needed, so divide copies of them instead
+            Nat dividend = lhs;
+            Nat divisor = rhs;
+            Nat::_long_divide(quotient, remainder, dividend, divisor);
+        } else {
+            Nat::_long_divide(quotient, remainder, lhs, rhs);
         }
         quotient._validate_digits();
         remainder._validate_digits();
-        return {quotient, remainder};
+    }
+
+    // define and lift scope of divmod() friend from ADL into arby's scope
+    constexpr DivisionResult<Nat> divmod(const Nat& lhs, const Nat& rhs) {
+        DivisionResult<Nat> result;
+        divmod(result.quotient, result.remainder, lhs, rhs);
+        return result;
     }
 
     /**
@@ -1056,19 +1941,369 @@ namespace com::saxbophone::arby {
         return power;
     }
 
-    // define and lift scope of ilog() friend from ADL into arby's scope
-    constexpr Interval<uintmax_t> ilog(const Nat& base, const Nat& x) {
-        if (base < 2) { throw std::domain_error("ilog: base cannot be < 2"); }
-        if (x < 1) { throw std::domain_error("ilog: x cannot be < 1"); }
-        // if base is 2, count the bits
-        if (base == 2) {
-            auto count = x.bit_length();
-            if (x.is_power_of_2()) {
-                return {count - 1}; // 1 followed by count-1 many zeroes
-            } else {
-                return {count - 1, count};
-            }
-        }
+    namespace PRIVATE {
+        /*
+         * Montgomery multiplication modulo an odd modulus N, with R = BASEᵏ
+         * where k is the number of digits of N. Values are kept in Montgomery
+         * form (aR mod N), which lets each product be reduced by adding
+         * multiples of N one digit at a time and shifting, instead of dividing.
+         */
+        struct Montgomery {
+            constexpr Montgomery() = default;
+            // precomputes the constants for the given modulus, which must be odd
+            constexpr Montgomery(const Nat& modulus)
+              : modulus(modulus)
+              , size(modulus.digit_length())
+              {
+                // Newton's iteration for N⁻¹ mod BASE, doubling the number of correct bits each time
+                Nat::OverflowType low = modulus._digits.back();
+                Nat::OverflowType inverse = 1; // correct to 1 bit, as N is odd
+                for (std::size_t bits = 1; bits < Nat::BITS_PER_DIGIT; bits *= 2) {
+                    inverse *= 2 - low * inverse;
+                }
+                negative_inverse = (Nat::StorageType)(0 - inverse);
+                // R² mod N converts a value to Montgomery form with one multiplication
+                r_squared = (Nat(1) << (2 * size * Nat::BITS_PER_DIGIT)) % modulus;
+              }
+
+            // returns abR⁻¹ mod N, for a < R and b < N
+            constexpr Nat multiply(const Nat& a, const Nat& b) const {
+                Nat product;
+                auto it = a._digits.rbegin();
+                // interleave multiplying with reduction, one digit of a at a time
+                for (std::size_t i = 0; i < size; i++) {
+                    Nat::StorageType digit = 0;
+                    if (it != a._digits.rend()) {
+                        digit = *it;
+                        it++;
+                    }
+                    product._add_multiple(b, digit);
+                    // adding this multiple of N clears the last digit, so we can shift it away
+                    Nat::StorageType m = (Nat::StorageType)((Nat::OverflowType)product._digits.back() * negative_inverse);
+                    product._add_multiple(modulus, m);
+                    product._drop_last_digit();
+                }
+                // product < 2N at this point
+                if (product >= modulus) {
+                    product -= modulus;
+                }
+                return product;
+            }
+
+            // returns aR mod N, for any a
+            constexpr Nat to_montgomery(const Nat& a) const {
+                return multiply(a < modulus ? a : a % modulus, r_squared);
+            }
+
+            // returns aR⁻¹ mod N, for a < N
+            constexpr Nat from_montgomery(const Nat& a) const {
+                return multiply(a, 1);
+            }
+
+            Nat modulus;
+            std::size_t size = 0; // number of digits in modulus
+            Nat::StorageType negative_inverse = 0; // -N⁻¹ mod BASE
+            Nat r_squared; // R² mod N
+        };
+
+        // picks a window width for sliding window exponentiation, trading table size against multiplications
+        constexpr std::size_t powmod_window_width(std::size_t exponent_bits) {
+            if (exponent_bits <= 16) { return 1; }
+            if (exponent_bits <= 96) { return 3; }
+            if (exponent_bits <= 384) { return 4; }
+            if (exponent_bits <= 1536) { return 5; }
+            return 6;
+        }
+
+        /*
+         * left-to-right sliding window exponentiation, with `one` being the
+         * multiplicative identity and multiply() doing all of the arithmetic,
+         * so that it works for any representation of the residues
+         */
+        template <typename Multiply>
+        constexpr Nat sliding_window_pow(const Nat& base, const Nat& exponent, const Nat& one, Multiply multiply) {
+            constexpr std::size_t MAX_WIDTH = 6;
+            std::size_t width = powmod_window_width(exponent.bit_length());
+            // odd powers of base: base¹, base³, base⁵ ... base^(2^width - 1)
+            std::array<Nat, (std::size_t)1 << (MAX_WIDTH - 1)> odd_powers;
+            odd_powers[0] = base;
+            if (width > 1) {
+                Nat square = multiply(base, base);
+                for (std::size_t i = 1; i < ((std::size_t)1 << (width - 1)); i++) {
+                    odd_powers[i] = multiply(odd_powers[i - 1], square);
+                }
+            }
+            Nat result = one;
+            std::size_t window = 0; // bits of the current window, always starting with a 1
+            std::size_t window_length = 0;
+            auto flush = [&]() {
+                // trailing zeroes of the window become squarings after the multiplication
+                std::size_t trailing = 0;
+                while ((window & 1) == 0) {
+                    window >>= 1;
+                    trailing++;
+                }
+                for (std::size_t i = 0; i < window_length - trailing; i++) {
+                    result = multiply(result, result);
+                }
+                result = multiply(result, odd_powers[window >> 1]);
+                for (std::size_t i = 0; i < trailing; i++) {
+                    result = multiply(result, result);
+                }
+                window = 0;
+                window_length = 0;
+            };
+            // scan the bits of the exponent, most significant first
+            for (auto digit : exponent.digits()) {
+                for (std::size_t b = std::numeric_limits<Nat::StorageType>::digits; b-- > 0; ) {
+                    std::size_t bit = (digit >> b) & 1;
+                    if (window_length == 0) {
+                        if (bit == 0) {
+                            result = multiply(result, result);
+                        } else {
+                            window = 1;
+                            window_length = 1;
+                        }
+                    } else {
+                        window = (window << 1) | bit;
+                        window_length++;
+                    }
+                    if (window_length == width) {
+                        flush();
+                    }
+                }
+            }
+            if (window_length > 0) {
+                flush();
+            }
+            return result;
+        }
+    }
+
+    /**
+     * @brief Modular exponentiation
+     * @returns \f$base^{exponent} \bmod modulus\f$
+     * @details Uses sliding window exponentiation, so intermediate values never
+     * grow beyond twice the size of `modulus`. Odd moduli use Montgomery
+     * multiplication to avoid division altogether, even moduli fall back to
+     * taking the remainder of each product.
+     * @throws std::domain_error when `modulus` is zero
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr Nat powmod(const Nat& base, const Nat& exponent, const Nat& modulus) {
+        if (not modulus) { throw std::domain_error("powmod: modulus cannot be zero"); }
+        if (modulus == 1) { return 0; } // everything is congruent to zero modulo 1
+        if (not exponent) { return 1; }
+        if (modulus & 1) {
+            PRIVATE::Montgomery montgomery(modulus);
+            Nat result = PRIVATE::sliding_window_pow(
+                montgomery.to_montgomery(base),
+                exponent,
+                montgomery.to_montgomery(1),
+                [&](const Nat& a, const Nat& b) { return montgomery.multiply(a, b); }
+            );
+            return montgomery.from_montgomery(result);
+        } else {
+            return PRIVATE::sliding_window_pow(
+                base % modulus,
+                exponent,
+                1,
+                [&](const Nat& a, const Nat& b) { return (a * b) % modulus; }
+            );
+        }
+    }
+
+    namespace PRIVATE {
+        // Euclid's algorithm for values which fit into a single word, shifting out factors of 2 instead of dividing
+        constexpr uintmax_t binary_gcd(uintmax_t a, uintmax_t b) {
+            if (a == 0) { return b; }
+            if (b == 0) { return a; }
+            int shift = std::countr_zero(a | b); // common factors of 2
+            a >>= std::countr_zero(a);
+            while (b != 0) {
+                b >>= std::countr_zero(b);
+                // both odd now, so their difference is even
+                if (a > b) {
+                    std::swap(a, b);
+                }
+                b -= a;
+            }
+            return a << shift;
+        }
+
+        // the number of leading bits from which Lehmer's algorithm simulates the Euclidean steps
+        constexpr std::size_t LEHMER_BITS = std::numeric_limits<Nat::StorageType>::digits;
+
+        /*
+         * Cofactors of a run of Euclidean steps worked out from the leading
+         * bits alone, such that the values after those steps are
+         * (a × u + b × v, a × w + b × x). Each cofactor fits into a digit, and
+         * u, x are of opposite sign to v, w.
+         */
+        struct LehmerMatrix {
+            std::int64_t u = 1, v = 0;
+            std::int64_t w = 0, x = 1;
+            std::size_t steps = 0;
+        };
+
+        /*
+         * Knuth's Algorithm L, taking the leading bits of both values, which
+         * are only trusted for as long as the quotients of both bounds agree
+         */
+        constexpr LehmerMatrix lehmer_matrix(std::int64_t a, std::int64_t b) {
+            LehmerMatrix m;
+            while (b + m.w != 0 and b + m.x != 0) {
+                std::int64_t q = (a + m.u) / (b + m.w);
+                if (q != (a + m.v) / (b + m.x)) { break; }
+                std::int64_t t = m.u - q * m.w;
+                m.u = m.w;
+                m.w = t;
+                t = m.v - q * m.x;
+                m.v = m.x;
+                m.x = t;
+                t = a - q * b;
+                a = b;
+                b = t;
+                m.steps++;
+            }
+            return m;
+        }
+
+        // leading bits of a and b for Lehmer's algorithm, where a ≥ b
+        constexpr std::pair<std::int64_t, std::int64_t> lehmer_leading_bits(const Nat& a, const Nat& b) {
+            std::size_t shift = a.bit_length() - LEHMER_BITS;
+            return {(std::int64_t)(uintmax_t)(a >> shift), (std::int64_t)(uintmax_t)(b >> shift)};
+        }
+    }
+
+    // define and lift scope of gcd() friend from ADL into arby's scope
+    constexpr Nat gcd(const Nat& a, const Nat& b) {
+        Nat u = a;
+        Nat v = b;
+        if (u < v) {
+            std::swap(u, v);
+        }
+        while (v != 0) {
+            if (u.bit_length() <= (std::size_t)std::numeric_limits<uintmax_t>::digits) {
+                return PRIVATE::binary_gcd((uintmax_t)u, (uintmax_t)v);
+            }
+            auto [lead_u, lead_v] = PRIVATE::lehmer_leading_bits(u, v);
+            PRIVATE::LehmerMatrix m = PRIVATE::lehmer_matrix(lead_u, lead_v);
+            if (m.steps == 0) {
+                // leading bits weren't enough to take a single step, so do a full one
+                u %= v;
+                std::swap(u, v);
+            } else {
+                Nat next = Nat::_signed_combination(u, m.u, v, m.v);
+                v = Nat::_signed_combination(u, m.w, v, m.x);
+                u = std::move(next);
+            }
+        }
+        return u;
+    }
+
+    // define and lift scope of gcdext() friend from ADL into arby's scope
+    constexpr GcdResult<Nat> gcdext(const Nat& a, const Nat& b) {
+        if (a == 0 and b != 0) {
+            throw std::domain_error("gcdext: no unsigned coefficients exist when only a is zero");
+        }
+        /*
+         * Runs the Euclidean remainder sequence r₀ = a, r₁ = b, rᵢ₊₁ = rᵢ₋₁ mod rᵢ
+         * alongside the coefficients sᵢ, tᵢ for which a × sᵢ + b × tᵢ = rᵢ.
+         * The signs of these alternate, so only their magnitudes are stored
+         * and tᵢ is negative whenever i is even.
+         */
+        Nat r_prev = a, r = b;
+        Nat s_prev = 1, s = 0;
+        Nat t_prev = 0, t = 1;
+        bool odd = true; // whether the index of r is odd
+        while (r != 0) {
+            PRIVATE::LehmerMatrix m;
+            if (r_prev >= r and r_prev.bit_length() > PRIVATE::LEHMER_BITS) {
+                auto [lead_prev, lead] = PRIVATE::lehmer_leading_bits(r_prev, r);
+                m = PRIVATE::lehmer_matrix(lead_prev, lead);
+            }
+            if (m.steps == 0) {
+                // take a single step with a full division
+                auto [quotient, remainder] = divmod(r_prev, r);
+                r_prev = std::move(r);
+                r = std::move(remainder);
+                Nat s_next = s_prev + quotient * s;
+                s_prev = std::move(s);
+                s = std::move(s_next);
+                Nat t_next = t_prev + quotient * t;
+                t_prev = std::move(t);
+                t = std::move(t_next);
+                odd = not odd;
+            } else {
+                Nat r_next = Nat::_signed_combination(r_prev, m.u, r, m.v);
+                r = Nat::_signed_combination(r_prev, m.w, r, m.x);
+                r_prev = std::move(r_next);
+                // coefficients alternate in sign just as the cofactors do, so the magnitudes always add
+                auto magnitude = [](std::int64_t c) { return (Nat::StorageType)(c < 0 ? -c : c); };
+                Nat s_next = Nat::_sum_of_multiples(s_prev, magnitude(m.u), s, magnitude(m.v));
+                s = Nat::_sum_of_multiples(s_prev, magnitude(m.w), s, magnitude(m.x));
+                s_prev = std::move(s_next);
+                Nat t_next = Nat::_sum_of_multiples(t_prev, magnitude(m.u), t, magnitude(m.v));
+                t = Nat::_sum_of_multiples(t_prev, magnitude(m.w), t, magnitude(m.x));
+                t_prev = std::move(t_next);
+                if (m.steps % 2 == 1) {
+                    odd = not odd;
+                }
+            }
+        }
+        // the final coefficients are the cofactors of a and b, i.e. b / gcd and a / gcd
+        if (odd) {
+            // r_prev has an even index, so its sᵢ is positive and its tᵢ negative
+            return {r_prev, s_prev, t_prev};
+        } else {
+            // otherwise shift the solution by one multiple of the cofactors to make both positive
+            return {r_prev, s - s_prev, t - t_prev};
+        }
+    }
+
+    /**
+     * @brief Least common multiple
+     * @returns The smallest value which is a multiple of both `a` and `b`, or
+     * zero if either of them is zero
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr Nat lcm(const Nat& a, const Nat& b) {
+        if (a == 0 or b == 0) { return 0; }
+        return a / gcd(a, b) * b;
+    }
+
+    /**
+     * @brief Modular multiplicative inverse
+     * @returns \f$x\f$ such that \f$ax\equiv1\pmod{modulus}\f$, where
+     * \f$x<modulus\f$
+     * @throws std::domain_error when `modulus` is zero or when `a` has no
+     * inverse, i.e. shares a common factor with `modulus`
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr Nat invmod(const Nat& a, const Nat& modulus) {
+        if (modulus == 0) { throw std::domain_error("invmod: modulus cannot be zero"); }
+        if (modulus == 1) { return 0; } // everything is congruent to zero modulo 1
+        Nat reduced = a % modulus;
+        if (reduced == 0) { throw std::domain_error("invmod: value has no inverse for this modulus"); }
+        auto [g, x, y] = gcdext(reduced, modulus);
+        if (g != 1) { throw std::domain_error("invmod: value has no inverse for this modulus"); }
+        return x;
+    }
+
+    // define and lift scope of ilog() friend from ADL into arby's scope
+    constexpr Interval<uintmax_t> ilog(const Nat& base, const Nat& x) {
+        if (base < 2) { throw std::domain_error("ilog: base cannot be < 2"); }
+        if (x < 1) { throw std::domain_error("ilog: x cannot be < 1"); }
+        // if base is 2, count the bits
+        if (base == 2) {
+            auto count = x.bit_length();
+            if (x.is_power_of_2()) {
+                return {count - 1}; // 1 followed by count-1 many zeroes
+            } else {
+                return {count - 1, count};
+            }
+        }
         // if base is any other power of 2, we can count how many n-bit chunks there are
         if (base.is_power_of_2()) {
             auto b = ilog(2, base).floor; // floor=ceil in this case, as base is binary power
@@ -1076,6 +2311,30 @@ namespace com::saxbophone::arby {
             // floor-rounding the floor and ceil-rounding the ceil divided by b gives an accurate answer
             return {xl.floor / b, xl.ceil / b + (xl.ceil % b > 0)};
         }
+        // log of 1 is always 0, regardless of base
+        if (x == 1) { return {0}; }
+        // floating-point maths isn't available at compile-time
+        if (not std::is_constant_evaluated()) {
+            // estimate the answer as log₂(x) / log₂(base)
+            long double estimate = x._approximate_log2() / base._approximate_log2();
+            // this is far more than the rounding error of the estimate, which is bounded relative to its size
+            long double error = estimate * 0x1p-40L + 0x1p-40L;
+            uintmax_t floor = (uintmax_t)std::max(estimate - error, 0.0L);
+            uintmax_t ceil = (uintmax_t)(estimate + error);
+            // the real answer is sandwiched between two consecutive whole numbers
+            if (floor == ceil) {
+                return {floor, floor + 1};
+            }
+            // otherwise, ceil is the only whole number close enough to be the answer, check it with one power
+            Nat power = ipow(base, ceil);
+            if (power == x) {
+                return {ceil};
+            } else if (power < x) {
+                return {ceil, ceil + 1};
+            } else {
+                return {floor, ceil};
+            }
+        }
         // otherwise, find the smallest power of base that is just >= x
         // a good starting estimate can be found using log₂ of both base and x
         uintmax_t exponent = ilog(2, x).floor / ilog(2, base).ceil; // deliberate underestimate, but closer than 1
@@ -1089,8 +2348,213 @@ namespace com::saxbophone::arby {
         return {power == x ? exponent : floor, exponent};
     }
 
+    /**
+     * @brief Calculates integer log of `x` in base 10 as bounds of \f$log_{10}(x)\f$
+     * @pre \f$x\geq1\f$
+     * @throws std::domain_error when `x` is zero
+     * @returns Interval of \f$[floor, ceil]\f$ for \f$log_{10}(x)\f$
+     * @see ilog()
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr Interval<uintmax_t> ilog10(const Nat& x) {
+        return ilog(10, x);
+    }
+
+    /**
+     * @returns how many digits are needed to write `x` out in the given base
+     * @param x value to count the digits of
+     * @param base number base the digits are written in
+     * @pre \f$base\geq2\f$
+     * @throws std::domain_error when `base` is less than 2
+     * @note Zero is written with one digit
+     * @note Shares the fast path of ilog(), so this is usually
+     * @f$ \mathcal{O(1)} @f$ regardless of the size of `x`
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr uintmax_t digit_count(const Nat& x, const Nat& base = 10) {
+        if (base < 2) { throw std::domain_error("digit_count: base cannot be < 2"); }
+        if (not x) { return 1; }
+        return ilog(base, x).floor + 1;
+    }
+
+    namespace PRIVATE {
+        // square roots of values no wider than this are found with native integer arithmetic
+        constexpr std::size_t ISQRT_BASECASE_BITS = std::numeric_limits<uintmax_t>::digits;
+
+        // digit-by-digit square root with remainder of a native integer
+        constexpr SqrtResult<uintmax_t> isqrtrem_basecase(uintmax_t x) {
+            uintmax_t root = 0;
+            uintmax_t remainder = x;
+            // highest power of 4 that is not greater than x
+            uintmax_t bit = (uintmax_t)1 << (std::numeric_limits<uintmax_t>::digits - 2);
+            while (bit > remainder) {
+                bit >>= 2;
+            }
+            while (bit != 0) {
+                if (remainder >= root + bit) {
+                    remainder -= root + bit;
+                    root = (root >> 1) + bit;
+                } else {
+                    root >>= 1;
+                }
+                bit >>= 2;
+            }
+            return {root, remainder};
+        }
+
+        /*
+         * Zimmermann's Karatsuba square root: x is treated as four k-bit limbs
+         * a₃β³ + a₂β² + a₁β + a₀ where β = 2ᵏ, the root of the top half a₃β + a₂
+         * is found recursively and the next k bits of the root come from a
+         * single division, followed by at most one correction step.
+         */
+        constexpr SqrtResult<Nat> isqrtrem_karatsuba(const Nat& x) {
+            std::size_t bits = x.bit_length();
+            if (bits <= ISQRT_BASECASE_BITS) {
+                return isqrtrem_basecase((uintmax_t)x);
+            }
+            std::size_t k = (bits + 3) / 4;
+            // normalise by shifting up an even number of bits such that a₃ ≥ β/4
+            std::size_t shift = (4 * k - bits) / 2;
+            Nat m = x << (2 * shift);
+            Nat mask = (Nat(1) << k) - 1;
+            Nat a0 = m & mask;
+            Nat a1 = (m >> k) & mask;
+            auto [high_root, high_remainder] = isqrtrem_karatsuba(m >> (2 * k));
+            auto [q, u] = divmod((high_remainder << k) + a1, high_root << 1);
+            Nat root = (high_root << k) + q;
+            Nat remainder = (u << k) + a0;
+            Nat q_squared = q * q;
+            // the remainder would have gone negative, meaning the root is one too big
+            if (remainder < q_squared) {
+                remainder += (root << 1) - 1;
+                --root;
+            }
+            remainder -= q_squared;
+            if (shift > 0) {
+                /*
+                 * undo normalisation. shift is only ever 0 or 1, so if the root
+                 * of m is 2s + s₀, then the root of x is s and its remainder is
+                 * (remainder + 4s·s₀ + s₀²) / 4
+                 */
+                bool low_bit = (bool)(root & 1);
+                root >>= 1;
+                if (low_bit) {
+                    remainder += (root << 2) + 1;
+                }
+                remainder >>= 2;
+            }
+            return {root, remainder};
+        }
+
+        // look-up table of which residues modulo M are the squares of some number
+        template <std::size_t M>
+        constexpr std::array<bool, M> quadratic_residues() {
+            std::array<bool, M> residues = {};
+            for (std::size_t i = 0; i < M; i++) {
+                residues[(i * i) % M] = true;
+            }
+            return residues;
+        }
+    }
+
+    /**
+     * @brief Calculates integer square root with remainder
+     * @details Uses Zimmermann's Karatsuba Square Root algorithm, which costs
+     * about as much as one multiplication of numbers the size of `x`
+     * @returns SqrtResult of {root, remainder} where \f$root=\lfloor\sqrt{x}\rfloor\f$
+     * and \f$remainder=x-root^2\f$
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr SqrtResult<Nat> isqrtrem(const Nat& x) {
+        return PRIVATE::isqrtrem_karatsuba(x);
+    }
+
+    /**
+     * @brief Calculates integer square root
+     * @returns \f$\lfloor\sqrt{x}\rfloor\f$
+     * @see isqrtrem()
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr Nat isqrt(const Nat& x) {
+        return isqrtrem(x).root;
+    }
+
+    // define and lift scope of is_perfect_square() friend from ADL into arby's scope
+    constexpr bool is_perfect_square(const Nat& x) {
+        constexpr auto SQUARES_MOD_64 = PRIVATE::quadratic_residues<64>();
+        constexpr auto SQUARES_MOD_63 = PRIVATE::quadratic_residues<63>();
+        constexpr auto SQUARES_MOD_65 = PRIVATE::quadratic_residues<65>();
+        constexpr auto SQUARES_MOD_11 = PRIVATE::quadratic_residues<11>();
+        // modulo 64 is free, as it's just the lowest bits
+        if (not SQUARES_MOD_64[x._digits.back() % 64]) {
+            return false;
+        }
+        // the others all come from a single pass over the digits, as 63·65·11 fits in one digit
+        Nat::StorageType residue = x._remainder_by_digit(63 * 65 * 11);
+        if (not (SQUARES_MOD_63[residue % 63] and SQUARES_MOD_65[residue % 65] and SQUARES_MOD_11[residue % 11])) {
+            return false;
+        }
+        return isqrtrem(x).remainder == 0;
+    }
+
+    namespace PRIVATE {
+        // roots with no more than this many bits are seeded straight from floating-point
+        constexpr uintmax_t IROOT_SEED_BITS = std::numeric_limits<double>::digits;
+
+        // one step of Newton's iteration for ⁿ√x: r' = ((n-1)r + x / rⁿ⁻¹) / n
+        constexpr Nat iroot_newton_step(uintmax_t n, const Nat& x, const Nat& root) {
+            auto [quotient, discard] = divmod(x, ipow(root, n - 1));
+            return (root * (n - 1) + quotient) / n;
+        }
+
+        // overestimates ⁿ√x using floating-point, for roots no wider than IROOT_SEED_BITS
+        constexpr Nat iroot_seed(uintmax_t n, const Nat& x) {
+            std::size_t bits = x.bit_length();
+            if (std::is_constant_evaluated()) {
+                // no floating-point maths library at compile-time, settle for a power of 2 above the root
+                return Nat(1) << (bits / n + 1);
+            }
+            // take log₂(x) from its leading bits only, as x may be far out of range for long double
+            std::size_t shift = bits > std::numeric_limits<uintmax_t>::digits ? bits - std::numeric_limits<uintmax_t>::digits : 0;
+            long double leading = (long double)(uintmax_t)(x >> shift);
+            long double log_root = (std::log2(leading) + (long double)shift) / (long double)n;
+            /*
+             * nudge the estimate up past any rounding error: Newton's iteration
+             * only homes in quickly from above, from below it overshoots by a
+             * factor that grows with n and then crawls back down
+             */
+            return Nat::from_float(std::exp2(log_root) * (1.0L + 0x1p-32L)) + 1;
+        }
+
+        // returns ⌊ⁿ√x⌋ for n ≥ 2 and x ≥ 2ⁿ
+        constexpr Nat iroot_floor(uintmax_t n, const Nat& x) {
+            uintmax_t root_bits = x.bit_length() / n;
+            Nat root;
+            if (root_bits <= IROOT_SEED_BITS) {
+                // from any positive starting point, one iteration lands on or above the floor of the root
+                root = iroot_newton_step(n, x, iroot_seed(n, x));
+            } else {
+                // find the root of the leading part of x to half the precision, then shift it back up.
+                // rounding that root up makes this an overestimate with roughly half its bits correct
+                uintmax_t k = root_bits / 2;
+                root = (iroot_floor(n, x >> (n * k)) + 1) << k;
+            }
+            // from above the floor, Newton's iteration descends monotonically and converges quadratically onto it
+            while (true) {
+                Nat next = iroot_newton_step(n, x, root);
+                if (next >= root) {
+                    return root;
+                }
+                root = next;
+            }
+        }
+    }
+
     /**
      * @brief Calculates integer root \f$[floor, ceil] = \sqrt[n]{x}\f$
+     * @details Uses Newton's iteration at doubling precision, seeded from a
+     * floating-point estimate of the root's leading bits
      * @returns Interval of floor and ceiling of the given root
      * @pre \f$n\neq0\f$
      * @pre \f$floor\leqceil\f$ for returned Interval
@@ -1103,25 +2567,557 @@ namespace com::saxbophone::arby {
         if (n == 0) { throw std::domain_error("0th root is undefined"); }
         if (x < 2) { return x; } // any root of 0 or 1 is always 0 or 1
         if (n == 1) { return x; } // 1th root of anything is itself
-        // use the bit-length of x to derive an estimate for nth root magnitude
-        auto w = ilog(2, x);
-        // then derive floor and ceiling of 2**w/n
-        auto floor = ipow(2, w.floor / n);
-        auto ceil = ipow(2, w.ceil / n + (w.ceil % n > 0));
-        // the answer lies somewhere between 2**floor and 2**ceil
-        // use binary search over that interval to home in on the real answer
-        while (ceil - floor > 1) {
-            auto estimate = (floor + ceil) / 2;
-            auto trial = ipow(estimate, n);
-            if (trial == x) { return estimate; } // exact match
-            if (trial > x) { ceil = estimate; } // too high
-            if (trial < x) { floor = estimate; } // too low
-        }
-        return {floor, ceil};
+        if (n == 2) { // square roots have their own faster algorithm
+            auto [root, remainder] = isqrtrem(x);
+            if (remainder == 0) {
+                return root;
+            } else {
+                return {root, root + 1};
+            }
+        }
+        // when x < 2ⁿ, the root lies somewhere between 1 and 2 (it can't be exactly 1 as x > 1)
+        if (x.bit_length() <= n) { return {1, 2}; }
+        Nat floor = PRIVATE::iroot_floor(n, x);
+        // floor = ceil only when x is a perfect nth power
+        if (ipow(floor, n) == x) {
+            return floor;
+        } else {
+            return {floor, floor + 1};
+        }
+    }
+
+    namespace PRIVATE {
+        // Jacobi symbol (a/n) for odd n
+        constexpr int jacobi(uintmax_t a, uintmax_t n) {
+            int result = 1;
+            a %= n;
+            while (a != 0) {
+                // pull out factors of 2, (2/n) = -1 when n ≡ ±3 (mod 8)
+                while ((a & 1) == 0) {
+                    a >>= 1;
+                    if (n % 8 == 3 or n % 8 == 5) {
+                        result = -result;
+                    }
+                }
+                // quadratic reciprocity, flipping sign when both are ≡ 3 (mod 4)
+                std::swap(a, n);
+                if (a % 4 == 3 and n % 4 == 3) {
+                    result = -result;
+                }
+                a %= n;
+            }
+            return n == 1 ? result : 0;
+        }
+
+        // (a + b) mod N, for a, b < N
+        constexpr Nat add_modulo(const Nat& a, const Nat& b, const Nat& modulus) {
+            Nat sum = a + b;
+            if (sum >= modulus) {
+                sum -= modulus;
+            }
+            return sum;
+        }
+
+        // (a - b) mod N, for a, b < N
+        constexpr Nat subtract_modulo(const Nat& a, const Nat& b, const Nat& modulus) {
+            return a >= b ? a - b : modulus - (b - a);
+        }
+
+        // a / 2 mod N, for a < N and odd N
+        constexpr Nat halve_modulo(const Nat& a, const Nat& modulus) {
+            return (a & 1) ? (a + modulus) >> 1 : a >> 1;
+        }
+
+        // strong probable-prime test of N (the modulus of montgomery) to the given base
+        constexpr bool miller_rabin(const Montgomery& montgomery, const Nat& base) {
+            const Nat& n = montgomery.modulus;
+            // n - 1 = d × 2ˢ, with d odd
+            Nat d = n - 1;
+            std::size_t s = 0;
+            while ((d & 1) == 0) {
+                d >>= 1;
+                s++;
+            }
+            Nat one = montgomery.to_montgomery(1);
+            Nat minus_one = n - one;
+            auto multiply = [&](const Nat& a, const Nat& b) { return montgomery.multiply(a, b); };
+            Nat x = sliding_window_pow(montgomery.to_montgomery(base), d, one, multiply);
+            if (x == one or x == minus_one) { return true; }
+            for (std::size_t i = 1; i < s; i++) {
+                x = multiply(x, x);
+                if (x == minus_one) { return true; }
+                if (x == one) { return false; } // found a non-trivial square root of 1
+            }
+            return false;
+        }
+
+        /*
+         * strong Lucas probable-prime test of N (the modulus of montgomery),
+         * with P = 1 and Q = (1 - D) / 4, all arithmetic in Montgomery form
+         */
+        constexpr bool strong_lucas(const Montgomery& montgomery, std::int64_t d_parameter) {
+            const Nat& n = montgomery.modulus;
+            auto multiply = [&](const Nat& a, const Nat& b) { return montgomery.multiply(a, b); };
+            // converts a small signed value into Montgomery form
+            auto convert = [&](std::int64_t value) {
+                Nat magnitude = montgomery.to_montgomery((uintmax_t)(value < 0 ? -value : value));
+                return value < 0 ? subtract_modulo(0, magnitude, n) : magnitude;
+            };
+            Nat d_form = convert(d_parameter);
+            Nat q_form = convert((1 - d_parameter) / 4);
+            // n + 1 = k × 2ˢ, with k odd
+            Nat k = n + 1;
+            std::size_t s = 0;
+            while ((k & 1) == 0) {
+                k >>= 1;
+                s++;
+            }
+            // U₁ = 1, V₁ = P = 1, working up to Uₖ, Vₖ and Qᵏ by doubling and incrementing the index
+            Nat u = montgomery.to_montgomery(1);
+            Nat v = u;
+            Nat q_power = q_form;
+            bool leading = true;
+            for (auto digit : k.digits()) {
+                for (std::size_t b = std::numeric_limits<Nat::StorageType>::digits; b-- > 0; ) {
+                    bool bit = (digit >> b) & 1;
+                    if (leading) {
+                        // skip up to and including the most significant bit, which U₁ and V₁ account for
+                        leading = not bit;
+                        continue;
+                    }
+                    // U₂ⱼ = UⱼVⱼ, V₂ⱼ = Vⱼ² - 2Qʲ
+                    u = multiply(u, v);
+                    v = subtract_modulo(multiply(v, v), add_modulo(q_power, q_power, n), n);
+                    q_power = multiply(q_power, q_power);
+                    if (bit) {
+                        // Uⱼ₊₁ = (PUⱼ + Vⱼ) / 2, Vⱼ₊₁ = (DUⱼ + PVⱼ) / 2
+                        Nat u_next = halve_modulo(add_modulo(u, v, n), n);
+                        v = halve_modulo(add_modulo(multiply(d_form, u), v, n), n);
+                        u = std::move(u_next);
+                        q_power = multiply(q_power, q_form);
+                    }
+                }
+            }
+            if (u == 0 or v == 0) { return true; }
+            for (std::size_t r = 1; r < s; r++) {
+                v = subtract_modulo(multiply(v, v), add_modulo(q_power, q_power, n), n);
+                if (v == 0) { return true; }
+                q_power = multiply(q_power, q_power);
+            }
+            return false;
+        }
+    }
+
+    constexpr bool Nat::_is_bpsw_probable_prime(std::size_t rounds) const {
+        PRIVATE::Montgomery montgomery(*this);
+        if (not PRIVATE::miller_rabin(montgomery, 2)) { return false; }
+        // Selfridge's method: first D in 5, -7, 9, -11, 13... for which (D/n) = -1
+        std::int64_t d = 5;
+        while (true) {
+            StorageType magnitude = (StorageType)(d < 0 ? -d : d);
+            // (|D|/n) = (n/|D|) by quadratic reciprocity, up to sign
+            int symbol = PRIVATE::jacobi(_remainder_by_digit(magnitude), magnitude);
+            // correct for reciprocity when both are ≡ 3 (mod 4), and for (-1/n) when D is negative
+            bool n_is_3_mod_4 = (_digits.back() & 3) == 3;
+            if (n_is_3_mod_4 and (magnitude & 3) == 3) { symbol = -symbol; }
+            if (d < 0 and n_is_3_mod_4) { symbol = -symbol; }
+            if (symbol == -1) { break; }
+            // (D/n) = 0 means |D| shares a factor with n, which has no small factors, so it must be n itself
+            if (symbol == 0 and *this != magnitude) { return false; }
+            // perfect squares never give -1, so rule them out before searching too far
+            if (d == 13 and is_perfect_square(*this)) { return false; }
+            d = d < 0 ? 2 - d : -d - 2;
+        }
+        if (not PRIVATE::strong_lucas(montgomery, d)) { return false; }
+        for (std::size_t i = 0; i < rounds and i < PRIVATE::SMALL_PRIMES_COUNT; i++) {
+            if (not PRIVATE::miller_rabin(montgomery, PRIVATE::SMALL_PRIMES[i])) { return false; }
+        }
+        return true;
+    }
+
+    // define and lift scope of is_probable_prime() friend from ADL into arby's scope
+    constexpr bool is_probable_prime(const Nat& n, std::size_t rounds = 0) {
+        if (n < PRIVATE::SMALL_PRIMES_BOUND) {
+            return PRIVATE::SMALL_PRIMES_SIEVE[(std::size_t)(uintmax_t)n];
+        }
+        if ((n & 1) == 0) { return false; }
+        for (auto residue : n._small_prime_residues()) {
+            if (residue == 0) { return false; }
+        }
+        // no factors below the bound means that no composite below its square made it this far
+        if (n < PRIVATE::SMALL_PRIMES_BOUND * PRIVATE::SMALL_PRIMES_BOUND) { return true; }
+        return n._is_bpsw_probable_prime(rounds);
     }
 
+    // define and lift scope of next_prime() friend from ADL into arby's scope
+    constexpr Nat next_prime(const Nat& n) {
+        // candidates below the bound are looked up directly
+        if (n < PRIVATE::SMALL_PRIMES_BOUND - 1) {
+            for (std::size_t i = (std::size_t)(uintmax_t)n + 1; i < PRIVATE::SMALL_PRIMES_BOUND; i++) {
+                if (PRIVATE::SMALL_PRIMES_SIEVE[i]) { return i; }
+            }
+        }
+        // start at the first odd value after n
+        Nat base = n + ((n & 1) ? 2 : 1);
+        if (base < PRIVATE::SMALL_PRIMES_BOUND) {
+            base = PRIVATE::SMALL_PRIMES_BOUND + 1;
+        }
+        auto residues = base._small_prime_residues();
+        for (uintmax_t offset = 0; ; offset += 2) {
+            // cheap sieve: reject the candidate if any small prime divides it
+            bool composite = false;
+            for (std::size_t i = 0; i < PRIVATE::SMALL_PRIMES_COUNT; i++) {
+                if ((residues[i] + offset) % PRIVATE::SMALL_PRIMES[i] == 0) {
+                    composite = true;
+                    break;
+                }
+            }
+            if (composite) { continue; }
+            Nat candidate = base + offset;
+            if (candidate < PRIVATE::SMALL_PRIMES_BOUND * PRIVATE::SMALL_PRIMES_BOUND or candidate._is_bpsw_probable_prime(0)) {
+                return candidate;
+            }
+        }
+    }
+
+    /**
+     * @brief Pair of consecutive Fibonacci numbers
+     * @returns `std::pair` of \f$(F_n, F_{n-1})\f$, where \f$F_{-1}=1\f$
+     * @details Uses fast doubling, working down the bits of `n`. Each step
+     * costs two squarings, using the identities:
+     * - \f$F_{2k+1}=4F_k^2-F_{k-1}^2+2(-1)^k\f$
+     * - \f$F_{2k-1}=F_k^2+F_{k-1}^2\f$
+     * - \f$F_{2k}=F_{2k+1}-F_{2k-1}\f$
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr std::pair<Nat, Nat> fib2(uintmax_t n) {
+        if (n == 0) { return {0, 1}; }
+        // (F(k), F(k - 1)), starting with k = 1 at the most significant bit of n
+        Nat current = 1;
+        Nat previous = 0;
+        bool k_is_odd = true;
+        for (int b = std::numeric_limits<uintmax_t>::digits - std::countl_zero(n) - 1; b-- > 0; ) {
+            current *= current;
+            previous *= previous;
+            // F(2k + 1) = 4F(k)² - F(k - 1)² ± 2
+            Nat next = current << 2;
+            next -= previous;
+            if (k_is_odd) {
+                next -= 2;
+            } else {
+                next += 2;
+            }
+            // F(2k - 1) = F(k)² + F(k - 1)², reusing the storage of the old values
+            previous += current;
+            if ((n >> b) & 1) {
+                // k becomes 2k + 1, so we need (F(2k + 1), F(2k))
+                current = std::move(next);
+                previous = current - previous;
+                k_is_odd = true;
+            } else {
+                // k becomes 2k, so we need (F(2k), F(2k - 1))
+                next -= previous;
+                current = std::move(next);
+                k_is_odd = false;
+            }
+        }
+        return {current, previous};
+    }
+
+    /**
+     * @brief Fibonacci numbers
+     * @returns \f$F_n\f$, where \f$F_0=0\f$ and \f$F_1=1\f$
+     * @details Uses fast doubling, see fib2()
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr Nat fibonacci(uintmax_t n) {
+        return fib2(n).first;
+    }
+
+    /**
+     * @brief Lucas numbers
+     * @returns \f$L_n\f$, where \f$L_0=2\f$ and \f$L_1=1\f$
+     * @details Found as \f$L_n=F_n+2F_{n-1}\f$ from fib2()
+     * @relates com::saxbophone::arby::Nat
+     */
+    constexpr Nat lucas(uintmax_t n) {
+        auto [current, previous] = fib2(n);
+        return current + (previous << 1);
+    }
+
+    // define and lift scope of random_bits() friend from ADL into arby's scope
+    template <typename Generator>
+    Nat random_bits(Generator& generator, std::size_t bits) {
+        std::uniform_int_distribution<Nat::StorageType> digit(0, std::numeric_limits<Nat::StorageType>::max());
+        Nat result;
+        if (bits == 0) { return result; }
+        std::size_t size = (bits + Nat::BITS_PER_DIGIT - 1) / Nat::BITS_PER_DIGIT;
+        result._digits.push_front(size - 1, 0);
+        for (auto& d : result._digits) {
+            d = digit(generator);
+        }
+        // discard whichever bits of the leading digit are surplus
+        std::size_t surplus = size * Nat::BITS_PER_DIGIT - bits;
+        result._digits.front() >>= surplus;
+        result._remove_leading_zeroes();
+        return result;
+    }
+
+    // define and lift scope of random_below() friend from ADL into arby's scope
+    template <typename Generator>
+    Nat random_below(Generator& generator, const Nat& bound) {
+        if (bound == 0) { throw std::domain_error("random_below: bound cannot be zero"); }
+        std::uniform_int_distribution<Nat::StorageType> digit(0, std::numeric_limits<Nat::StorageType>::max());
+        std::uniform_int_distribution<Nat::StorageType> leading(0, bound._digits.front());
+        Nat result;
+        result._digits.push_front(bound._digits.size() - 1, 0);
+        while (true) {
+            // whether every digit so far is equal to the bound's, i.e. whether we could still reach or exceed it
+            bool level = true;
+            bool rejected = false;
+            auto limit = bound._digits.begin();
+            for (auto it = result._digits.begin(); it != result._digits.end(); it++, limit++) {
+                *it = it == result._digits.begin() ? leading(generator) : digit(generator);
+                if (level) {
+                    if (*it > *limit) {
+                        rejected = true;
+                        break;
+                    }
+                    level = *it == *limit;
+                }
+            }
+            // being level all the way down means we generated the bound itself
+            if (not rejected and not level) { break; }
+        }
+        result._remove_leading_zeroes();
+        return result;
+    }
+
+    /**
+     * @brief Factorial
+     * @returns \f$n!\f$
+     * @details Uses the prime-swing algorithm, which finds the odd part of
+     * \f$n!\f$ as \f$(\lfloor\frac{n}{2}\rfloor!)^2\f$ times the swing
+     * numbers, which are assembled from their prime factors, and takes care
+     * of the powers of 2 with a bit-shift
+     * @note All products are taken as balanced product trees, so the expensive
+     * multiplications are few and of similarly-sized operands
+     * @relates com::saxbophone::arby::Nat
+     */
+    Nat factorial(uintmax_t n);
+
+    /**
+     * @brief Binomial coefficient
+     * @returns \f$\binom{n}{k}\f$, the number of ways to choose `k` items
+     * from `n`, which is zero when \f$k>n\f$
+     * @details Built from its prime factorisation (using Kummer's theorem),
+     * so no division is needed. When `n` is so much larger than `k` that
+     * sieving primes up to `n` would cost far more than the result's size,
+     * the product \f$(n-k+1)\cdots n\f$ is divided by \f$k!\f$ instead.
+     * @relates com::saxbophone::arby::Nat
+     */
+    Nat binomial(uintmax_t n, uintmax_t k);
+
+    /**
+     * @brief Double factorial
+     * @returns \f$n!!\f$, the product of all values from 1 to `n` which
+     * have the same parity as `n`
+     * @details Even `n` reduce to \f$2^{\frac{n}{2}}(\frac{n}{2})!\f$, odd
+     * `n` are built from their prime factorisation
+     * @relates com::saxbophone::arby::Nat
+     */
+    Nat double_factorial(uintmax_t n);
+
+    /**
+     * @brief Primorial
+     * @returns \f$n\#\f$, the product of all primes up to and including `n`
+     * @relates com::saxbophone::arby::Nat
+     */
+    Nat primorial(uintmax_t n);
+
+    namespace PRIVATE {
+        // multiplies all the factors together, leaving them in an unspecified state
+        Nat product_tree(std::vector<Nat>& factors, std::size_t threads);
+    }
+
+    /**
+     * @brief Product of a range of values
+     * @param first,last range of values convertible to Nat
+     * @param threads the most threads to multiply with, `0` meaning as many
+     * as the hardware supports
+     * @returns \f$\prod_{i=first}^{last}i\f$, which is `1` for an empty range
+     * @details The values are multiplied pairwise in a balanced tree rather
+     * than one after the other, so that the running product doesn't grow large
+     * early on and the expensive multiplications are few and of operands with
+     * similar sizes. When more than one thread is allowed, the halves of the
+     * tree are multiplied concurrently.
+     * @relates com::saxbophone::arby::Nat
+     */
+    template <std::input_iterator InputIt>
+    Nat product(InputIt first, InputIt last, std::size_t threads = 1) {
+        std::vector<Nat> factors(first, last);
+        return PRIVATE::product_tree(factors, threads);
+    }
+
+    /**
+     * @brief Writes the digits of a Nat into a caller-provided buffer, like
+     * `std::to_chars()`
+     * @details No prefix or leading zeroes are written and letters are
+     * lowercase. Nat::chars_needed() gives a size of buffer which is always
+     * big enough.
+     * @param first,last the buffer to write into
+     * @param value the value to write
+     * @param base number base to write in, from 2 to 36
+     * @returns `{end, std::errc()}` on success, where `end` is one past the
+     * last character written, otherwise `{last, std::errc::value_too_large}`
+     * when the buffer is too small, in which case its contents are unspecified
+     * @throws std::invalid_argument when base is out of range
+     * @relates com::saxbophone::arby::Nat
+     */
+    std::to_chars_result to_chars(char* first, char* last, const Nat& value, int base = 10);
+
+    /**
+     * @brief Reads the digits of a Nat from a buffer, like `std::from_chars()`
+     * @details The longest run of digits of the base at the start of the
+     * buffer is read, upper or lowercase letters both being accepted. Signs,
+     * prefixes and whitespace aren't.
+     * @param first,last the buffer to read from
+     * @param[out] value where to store the value read, only written to on success
+     * @param base number base to read in, from 2 to 36
+     * @returns `{end, std::errc()}` on success, where `end` is one past the
+     * last digit read, otherwise `{first, std::errc::invalid_argument}` when
+     * there are no digits to read
+     * @throws std::invalid_argument when base is out of range
+     * @relates com::saxbophone::arby::Nat
+     */
+    std::from_chars_result from_chars(const char* first, const char* last, Nat& value, int base = 10);
+
     /** @} */
 
+    namespace PRIVATE {
+        // returns the value of digit character c in bases up to 36, or 36 if it isn't a digit in any of them
+        constexpr std::uint8_t digit_value(char c) {
+            if (c >= '0' and c <= '9') { return (std::uint8_t)(c - '0'); }
+            if (c >= 'a' and c <= 'z') { return (std::uint8_t)(c - 'a' + 10); }
+            if (c >= 'A' and c <= 'Z') { return (std::uint8_t)(c - 'A' + 10); }
+            return 36;
+        }
+
+        [[noreturn]] inline void throw_invalid_digit(char c, std::size_t position, std::uint8_t base) {
+            throw std::invalid_argument(
+                "invalid digit '" + std::string(1, c) + "' at position " + std::to_string(position) +
+                " for base " + std::to_string(base)
+            );
+        }
+
+        /*
+         * value of the (already checked) digits [first, last), read chunk
+         * digits at a time into uintmax_t and combined as a balanced tree.
+         * power points at base^width, with each next one being its square root
+         */
+        template <typename Iterator>
+        constexpr Nat parse_chunks(const char* first, const char* last, std::uint8_t base, std::size_t chunk, Iterator power, std::size_t width) {
+            std::size_t length = (std::size_t)(last - first);
+            if (length <= chunk) {
+                uintmax_t value = 0;
+                for (; first != last; first++) {
+                    value = value * base + digit_value(*first);
+                }
+                return value;
+            }
+            // split off the largest power's worth of digits that still leaves some over for the high part
+            while (width >= length) {
+                power++;
+                width /= 2;
+            }
+            Nat value = parse_chunks(last - width, last, base, chunk, power, width);
+            addmul(value, parse_chunks(first, last - width, base, chunk, power, width), *power);
+            return value;
+        }
+
+        /*
+         * value of the (already checked) digits [first, last) in a base of
+         * 2ᵇⁱᵗˢ, which is just a regrouping of their bits into Nat's digits
+         */
+        constexpr Nat parse_bits(const char* first, const char* last, std::size_t bits) {
+            constexpr std::size_t DIGIT_BITS = std::numeric_limits<Nat::StorageType>::digits;
+            codlili::list<Nat::StorageType> digits;
+            // bits read but not yet stored in a digit, least significant first
+            Nat::OverflowType buffer = 0;
+            std::size_t buffered = 0;
+            for (const char* it = last; it != first; ) {
+                it--;
+                buffer |= (Nat::OverflowType)digit_value(*it) << buffered;
+                buffered += bits;
+                if (buffered >= DIGIT_BITS) {
+                    digits.push_front((Nat::StorageType)buffer);
+                    buffer >>= DIGIT_BITS;
+                    buffered -= DIGIT_BITS;
+                }
+            }
+            if (buffered > 0) {
+                digits.push_front((Nat::StorageType)buffer);
+            }
+            return digits;
+        }
+
+        /*
+         * value of the digits [first, last) in the given base, position being
+         * the index of first within the whole string, for error messages
+         */
+        constexpr Nat parse_digits(const char* first, const char* last, std::uint8_t base, std::size_t position) {
+            if (first == last) {
+                throw std::invalid_argument("cannot parse Nat from empty digits sequence");
+            }
+            for (const char* it = first; it != last; it++) {
+                if (digit_value(*it) >= base) {
+                    throw_invalid_digit(*it, position + (std::size_t)(it - first), base);
+                }
+            }
+            if (std::has_single_bit(base)) {
+                return parse_bits(first, last, (std::size_t)std::countr_zero(base));
+            }
+            // as many digits as always fit into uintmax_t, 19 for decimal
+            std::size_t chunk = fit(std::numeric_limits<uintmax_t>::max(), base) - 1;
+            std::size_t length = (std::size_t)(last - first);
+            // base^(chunk × 2ᵏ), largest first, up to the one that splits the digits closest to half-way
+            codlili::list<Nat> powers;
+            std::size_t width = chunk;
+            if (length > chunk) {
+                powers.push_front(ipow(base, (uintmax_t)chunk));
+                while (width * 2 < length) {
+                    powers.push_front(powers.front() * powers.front());
+                    width *= 2;
+                }
+            }
+            return parse_chunks(first, last, base, chunk, powers.begin(), width);
+        }
+
+        // value of the digits [first, last) written as for operator""_nat
+        constexpr Nat parse_literal(const char* first, const char* last) {
+            // detect number base
+            std::uint8_t base = 10; // base-10 is the fallback base
+            std::size_t prefix = 0;
+            if (last - first > 1 and first[0] == '0') { // first digit 0 followed by more, maybe a 0x/0b prefix?
+                switch (first[1]) {
+                case 'X': // hexadecimal
+                case 'x':
+                    base = 16;
+                    prefix = 2;
+                    break;
+                case 'B': // binary
+                case 'b':
+                    base = 2;
+                    prefix = 2;
+                    break;
+                default: // not allowed --we don't support 0-prefixed octal literals or anything else
+                    throw std::invalid_argument("invalid arby::Nat literal: leading zeroes are only allowed as part of a 0x or 0b prefix");
+                }
+            }
+            return parse_digits(first + prefix, last, base, prefix);
+        }
+    }
+
     /**
      * @brief Various custom user-defined-literals for creating arby objects
      * @note You need to introduce this namespace into global scope with
@@ -1141,42 +3137,15 @@ namespace com::saxbophone::arby {
          * @note we use a raw literal in this case because as the Nat type is
          * unbounded, we want to support a potentially infinite number of digits,
          * or certainly more than can be stored in unsigned long long...
+         * @note Digits are read as many at a time as fit into `uintmax_t`,
+         * and these chunks combined in a balanced tree with cached powers of
+         * the base, rather than multiplying up the whole value for each digit
+         * @throws std::invalid_argument when the literal has a leading zero
+         * other than as part of a `0x` or `0b` prefix
          * @relates com::saxbophone::arby::Nat
          */
         constexpr Nat operator "" _nat(const char* literal) {
-            // detect number base
-            std::uint8_t base = 10; // base-10 is the fallback base
-            if (literal[0] == '0' and literal[1] != 0) { // first digit 0, second non-null, maybe a 0x/0b prefix?
-                switch (literal[1]) {
-                case 'X': // hexadecimal
-                case 'x':
-                    base = 16;
-                    // advance string pointer to skip the prefix
-                    literal = literal + 2;
-                    break;
-                case 'B': // binary
-                case 'b':
-                    base = 2;
-                    literal = literal + 2;
-                    break;
-                default: // not allowed --we don't support 0-prefixed octal literals or anything else
-                    throw std::invalid_argument("invalid arby::Nat literal");
-                }
-            }
-            Nat value; // accumulator
-            // consume digits
-            while (*literal != 0) { // until null-terminator is found
-                std::uint8_t digit = (std::uint8_t)*literal; // get character
-                // when dealing with digits, subtract 32 from any after 'Z' to convert lowercase to upper
-                if (digit > 'Z') { digit -= 32; }
-                // calculate digit's value, handling the two contiguous ranges of 0-9 and A-F
-                std::uint8_t digit_value = digit >= 'A' ? (digit - 'A') + 10 : digit - '0';
-                // add to accumulator and then shift it up
-                value *= base;
-                value += digit_value;
-                literal++; // next character
-            }
-            return value;
+            return PRIVATE::parse_literal(literal, literal + std::char_traits<char>::length(literal));
         }
     }
 
@@ -1223,4 +3192,172 @@ public:
     static constexpr com::saxbophone::arby::Nat denorm_min() { return 0; } // N/A
 };
 
+#ifdef __cpp_lib_format
+/**
+ * @brief Support for formatting arby::Nat with `std::format()`
+ * @details The format specification is that of the standard integer types,
+ * `[[fill]align][sign][#][0][width][grouping][type]`, where:
+ * - `type` is one of `d` (the default), `b`, `B`, `o`, `x` or `X`
+ * - `#` adds the `0b`, `0B`, `0` (unless the value is zero), `0x` or `0X`
+ * prefix for the type
+ * - `0` pads with zeroes after the sign and prefix, unless `align` is given
+ * - `grouping` is `,` or `_`, separating groups of three digits in decimal,
+ * or four in the other bases, as in Python
+ * @note Width must be given directly, not as a nested replacement field.
+ * Precision and `L` are not supported.
+ * @note Digits are written by arby::to_chars() into a buffer on the stack
+ * (only numbers too long for it get one from the heap), and from there
+ * straight into the output, padding and separators included.
+ */
+template <>
+struct std::formatter<com::saxbophone::arby::Nat, char> {
+    constexpr std::format_parse_context::iterator parse(std::format_parse_context& context) {
+        auto it = context.begin();
+        auto last = context.end();
+        auto is_align = [](char c) { return c == '<' or c == '>' or c == '^'; };
+        if (it == last or *it == '}') { return it; }
+        // the fill character may be any one UTF-8 encoded code point, so find its length from the first byte
+        std::size_t fill_length = 1;
+        unsigned char lead = (unsigned char)*it;
+        if ((lead & 0xe0) == 0xc0) {
+            fill_length = 2;
+        } else if ((lead & 0xf0) == 0xe0) {
+            fill_length = 3;
+        } else if ((lead & 0xf8) == 0xf0) {
+            fill_length = 4;
+        }
+        if ((std::size_t)(last - it) > fill_length and is_align(it[(std::ptrdiff_t)fill_length])) {
+            if (*it == '{' or *it == '}') {
+                throw std::format_error("invalid fill character for arby::Nat");
+            }
+            std::copy_n(it, fill_length, _fill.begin());
+            _fill_length = fill_length;
+            it += (std::ptrdiff_t)fill_length;
+            _align = *it++;
+        } else if (is_align(*it)) {
+            _align = *it++;
+        }
+        if (it != last and (*it == '+' or *it == '-' or *it == ' ')) {
+            // '-' is the default, and nothing is ever written for it as Nat can't be negative
+            _sign = *it == '-' ? '\0' : *it;
+            it++;
+        }
+        if (it != last and *it == '#') {
+            _alternate = true;
+            it++;
+        }
+        if (it != last and *it == '0') {
+            _zero_pad = true;
+            it++;
+        }
+        while (it != last and *it >= '0' and *it <= '9') {
+            _width = _width * 10 + (std::size_t)(*it++ - '0');
+        }
+        if (it != last and *it == '{') {
+            throw std::format_error("arby::Nat doesn't support width given as a replacement field");
+        }
+        if (it != last and (*it == ',' or *it == '_')) {
+            _separator = *it++;
+        }
+        if (it != last and *it != '}') {
+            switch (*it) {
+            case 'd':
+                break;
+            case 'b':
+            case 'B':
+                _base = 2;
+                break;
+            case 'o':
+                _base = 8;
+                break;
+            case 'x':
+            case 'X':
+                _base = 16;
+                break;
+            default:
+                throw std::format_error("invalid format specification for arby::Nat");
+            }
+            _type = *it++;
+        }
+        if (it != last and *it != '}') {
+            throw std::format_error("invalid format specification for arby::Nat");
+        }
+        return it;
+    }
+
+    template <typename FormatContext>
+    typename FormatContext::iterator format(const com::saxbophone::arby::Nat& value, FormatContext& context) const {
+        // write the digits into a buffer on the stack, unless there isn't room
+        char local[256];
+        std::unique_ptr<char[]> allocated;
+        char* digits = local;
+        std::size_t needed = value.chars_needed(_base);
+        if (needed > sizeof(local)) {
+            allocated = std::make_unique<char[]>(needed);
+            digits = allocated.get();
+        }
+        std::size_t count = (std::size_t)(com::saxbophone::arby::to_chars(digits, digits + needed, value, _base).ptr - digits);
+        if (_type == 'X') {
+            std::transform(digits, digits + count, digits, [](char c) { return c >= 'a' ? (char)(c - 'a' + 'A') : c; });
+        }
+        std::string_view prefix;
+        if (_alternate) {
+            switch (_type) {
+            case 'b': prefix = "0b"; break;
+            case 'B': prefix = "0B"; break;
+            case 'o': prefix = value ? "0" : ""; break;
+            case 'x': prefix = "0x"; break;
+            case 'X': prefix = "0X"; break;
+            }
+        }
+        std::size_t group = _base == 10 ? 3 : 4;
+        std::size_t separators = _separator != '\0' ? (count - 1) / group : 0;
+        std::size_t length = (_sign != '\0' ? 1 : 0) + prefix.size() + count + separators;
+        std::size_t padding = _width > length ? _width - length : 0;
+        // zero-padding goes between the prefix and the digits, but only if no alignment was asked for
+        bool zeroes = _zero_pad and _align == '\0';
+        std::size_t before = 0;
+        if (not zeroes) {
+            before = _align == '<' ? 0 : _align == '^' ? padding / 2 : padding;
+        }
+        auto out = context.out();
+        auto fill = [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; i++) {
+                out = std::copy_n(_fill.begin(), _fill_length, out);
+            }
+        };
+        fill(before);
+        if (_sign != '\0') {
+            *out++ = _sign;
+        }
+        out = std::copy(prefix.begin(), prefix.end(), out);
+        if (zeroes) {
+            out = std::fill_n(out, padding, '0');
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            if (separators != 0 and i != 0 and (count - i) % group == 0) {
+                *out++ = _separator;
+            }
+            *out++ = digits[i];
+        }
+        if (not zeroes) {
+            fill(padding - before);
+        }
+        return out;
+    }
+
+private:
+    std::array<char, 4> _fill = {' '}; // UTF-8 code units of the fill character
+    std::size_t _fill_length = 1;
+    char _align = '\0'; // '\0' when not given, numbers being right-aligned by default
+    char _sign = '\0'; // '\0' for no sign character
+    bool _alternate = false;
+    bool _zero_pad = false;
+    std::size_t _width = 0;
+    char _separator = '\0'; // '\0' for no digit grouping
+    char _type = 'd';
+    int _base = 10;
+};
+#endif
+
 #endif // include guard
@@ -0,0 +1,199 @@
+/**
+ * @file
+ * @brief NatParser class for reading Nat values from text that arrives in pieces
+ * @note This file forms part of arby
+ * @details arby is a C++ library providing arbitrary-precision integer types
+ * @warning arby is alpha-quality software
+ *
+ * @author Joshua Saxby <joshua.a.saxby@gmail.com>
+ * @date May 2022
+ *
+ * @copyright Copyright Joshua Saxby <joshua.a.saxby@gmail.com> 2022
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef COM_SAXBOPHONE_ARBY_NAT_PARSER_HPP
+#define COM_SAXBOPHONE_ARBY_NAT_PARSER_HPP
+
+#include <cstddef> // size_t
+#include <cstdint>
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <arby/Nat.hpp>
+
+
+namespace com::saxbophone::arby {
+    /**
+     * @brief Reads the digits of a Nat from text given in pieces of any size
+     * @details Digits are collected into fixed-size blocks, each of which is
+     * converted as soon as it's complete, so at most one block of text is
+     * held at any time. Converted blocks are kept on a stack, and combined in
+     * pairs of equal size like the carries of a binary counter, which builds
+     * the same balanced tree as parsing all of the text in one go.
+     * @code
+     * arby::NatParser parser;
+     * while (file.read(buffer, sizeof(buffer)) or file.gcount() > 0) {
+     *     parser.feed({buffer, (std::size_t)file.gcount()});
+     * }
+     * arby::Nat value = parser.value();
+     * @endcode
+     */
+    class NatParser {
+    public:
+        /**
+         * @brief Prepares to read digits in the given base
+         * @param base number base of the digits, from 2 to 36
+         * @throws std::invalid_argument when base is out of range
+         */
+        explicit NatParser(int base = 10) : _base((std::uint8_t)base) {
+            if (base < 2 or base > 36) {
+                throw std::invalid_argument("number base must be from 2 to 36");
+            }
+            _block = (PRIVATE::fit(std::numeric_limits<uintmax_t>::max(), _base) - 1) * BLOCK_CHUNKS;
+            _pending.reserve(_block);
+        }
+
+        /**
+         * @brief Reads the next piece of digits, which may be of any length
+         * @details Upper and lowercase letters are both accepted in bases
+         * above 10, but nothing else besides digits of the base is
+         * @throws std::invalid_argument if any character isn't a digit of the
+         * base, in which case none of the piece is read
+         */
+        NatParser& feed(std::string_view digits) {
+            for (std::size_t i = 0; i < digits.size(); i++) {
+                if (PRIVATE::digit_value(digits[i]) >= _base) {
+                    PRIVATE::throw_invalid_digit(digits[i], _length + i, _base);
+                }
+            }
+            while (not digits.empty()) {
+                if (_pending.empty() and digits.size() >= _block) {
+                    // whole blocks can be converted straight from the input without copying
+                    _push(_parse(digits.data(), _block));
+                    _length += _block;
+                    digits.remove_prefix(_block);
+                    continue;
+                }
+                std::size_t count = std::min(digits.size(), _block - _pending.size());
+                _pending.append(digits.data(), count);
+                _length += count;
+                digits.remove_prefix(count);
+                if (_pending.size() == _block) {
+                    _push(_parse(_pending.data(), _block));
+                    _pending.clear();
+                }
+            }
+            return *this;
+        }
+
+        /**
+         * @returns How many digits have been read so far
+         */
+        std::size_t size() const {
+            return _length;
+        }
+
+        /**
+         * @returns The value of all the digits read so far, or zero if none
+         * have been
+         * @note This doesn't modify the parser, so it may be called from
+         * several threads at once, as long as none of them calls feed()
+         */
+        Nat value() const {
+            Nat result;
+            // the stack holds the most significant blocks first
+            for (const auto& [value, width] : _stack) {
+                result = _combine(result, value, width);
+            }
+            if (not _pending.empty()) {
+                result = _combine(result, _parse(_pending.data(), _pending.size()), _pending.size());
+            }
+            return result;
+        }
+
+    private:
+        /*
+         * each block is this many of the largest chunks of digits that always
+         * fit into uintmax_t (1216 digits for decimal), which is large enough
+         * for the blocks' own conversion to use a few levels of splitting
+         */
+        static constexpr std::size_t BLOCK_CHUNKS = 64;
+
+        struct Block {
+            Nat value;
+            std::size_t width; // in digits
+        };
+
+        Nat _parse(const char* digits, std::size_t count) const {
+            return PRIVATE::parse_digits(digits, digits + count, _base, 0);
+        }
+
+        // high × baseʷⁱᵈᵗʰ + low, for low of at most width digits
+        Nat _combine(const Nat& high, const Nat& low, std::size_t width) const {
+            if (not high) { return low; }
+            if (std::has_single_bit(_base)) {
+                return (high << (width * (std::size_t)std::countr_zero(_base))) | low;
+            }
+            Nat result = low;
+            addmul(result, high, _power(width));
+            return result;
+        }
+
+        /*
+         * baseʷⁱᵈᵗʰ, which is looked up from the cache when width is a whole
+         * number of blocks. _push() fills the cache for every width on the
+         * stack, so this never modifies it and value() stays truly const
+         */
+        Nat _power(std::size_t width) const {
+            if (width % _block != 0) {
+                return ipow(_base, (uintmax_t)width);
+            }
+            return _powers[(std::size_t)std::countr_zero(width / _block)];
+        }
+
+        // caches base^(block × 2ⁱ) for all i up to level, unless combining is done by shifting
+        void _cache_powers(std::size_t level) {
+            if (std::has_single_bit(_base)) { return; }
+            while (_powers.size() <= level) {
+                _powers.push_back(_powers.empty() ? ipow(_base, (uintmax_t)_block) : _powers.back() * _powers.back());
+            }
+        }
+
+        // pushes a whole block, combining it with any others of the same width before it
+        void _push(Nat value) {
+            std::size_t width = _block;
+            std::size_t level = 0;
+            while (not _stack.empty() and _stack.back().width == width) {
+                _cache_powers(level);
+                value = _combine(_stack.back().value, value, width);
+                width *= 2;
+                level++;
+                _stack.pop_back();
+            }
+            // value() combines with this block too, so its power must be cached already
+            _cache_powers(level);
+            _stack.push_back({std::move(value), width});
+        }
+
+        std::uint8_t _base;
+        std::size_t _block; // digits per block
+        std::size_t _length = 0; // digits read so far
+        std::string _pending; // digits not yet making up a whole block
+        std::vector<Block> _stack; // converted blocks, widths strictly decreasing
+        std::vector<Nat> _powers; // base^(block × 2ⁱ)
+    };
+}
+
+#endif // include guard
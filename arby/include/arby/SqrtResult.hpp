@@ -0,0 +1,98 @@
+/**
+ * @file
+ * @brief SqrtResult<T> struct represents results of square root with remainder
+ * @note This file forms part of arby
+ * @details arby is a C++ library providing arbitrary-precision integer types
+ * @warning arby is alpha-quality software
+ *
+ * @author Joshua Saxby <joshua.a.saxby@gmail.com>
+ * @date May 2022
+ *
+ * @copyright Copyright Joshua Saxby <joshua.a.saxby@gmail.com> 2022
+ *
+ * @copyright
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef COM_SAXBOPHONE_ARBY_SQRT_RESULT_HPP
+#define COM_SAXBOPHONE_ARBY_SQRT_RESULT_HPP
+
+#include <concepts> // convertible_to
+#include <tuple> // tuple
+#include <type_traits>
+
+#include <cstddef> // size_t
+
+
+namespace com::saxbophone::arby {
+    /**
+     * @brief Represents the result of Integer square root with remainder
+     * @details For some value \f$x\f$, this holds \f$root=\lfloor\sqrt{x}\rfloor\f$
+     * and \f$remainder=x-root^2\f$
+     * @note SqrtResult supports being used in structured bindings, i.e. the
+     * following code is valid:
+     * @code
+     * auto [root, remainder] = SqrtResult();
+     * @endcode
+     * @warning You shouldn't create a SqrtResult<> with a remainder larger than
+     * twice its root (no square root operation can produce this), but this
+     * isn't checked or enforced in any way by this struct.
+     */
+    template <typename T>
+    struct SqrtResult {
+        /**
+         * @brief Default-initialises both root and remainder
+         */
+        constexpr SqrtResult() {}
+
+        /**
+         * @brief Initialises both root and remainder to separate values
+         */
+        constexpr SqrtResult(T root, T remainder) : root(root), remainder(remainder) {}
+
+        /**
+         * @brief Provides support for structured bindings
+         * @note We only provide access as a copy
+         */
+        template <std::size_t N>
+        constexpr typename std::tuple_element<N, SqrtResult>::type get() const {
+            if constexpr (N == 0) return root;
+            else if constexpr (N == 1) return remainder;
+        }
+
+        /**
+         * @brief cast to other template of self
+         * @pre `(U)T{}` must be well-defined
+         */
+        template <typename U> requires std::convertible_to<T, U>
+        constexpr operator SqrtResult<U>() const {
+            return {(U)root, (U)remainder};
+        }
+
+        /**
+         * @brief enables defaulted equality-comparison between SqrtResults
+         */
+        constexpr bool operator==(const SqrtResult& other) const = default;
+
+        T root = {}; /**< square root, rounded down to the nearest whole number */
+        T remainder = {}; /**< how far the square of root falls short, i.e. if zero then the value is a perfect square */
+    };
+}
+
+/**
+ * @note for structured binding support
+ */
+template <typename T>
+struct std::tuple_size<com::saxbophone::arby::SqrtResult<T>> : std::integral_constant<std::size_t, 2> {};
+
+/**
+ * @note for structured binding support
+ */
+template <std::size_t N, typename T>
+struct std::tuple_element<N, com::saxbophone::arby::SqrtResult<T>> {
+    using type = T; /**< required for structured binding support */
+};
+
+#endif // include guard
@@ -12,53 +12,356 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include <algorithm>
-#include <iomanip>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <functional>
+#include <future>
+#include <istream>
 #include <limits>
-#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include <arby/DecimalChunks.hpp>
 #include <arby/Nat.hpp>
+#include <arby/NatParser.hpp>
 
 
 namespace com::saxbophone::arby {
+    namespace {
+        // product of factors [first, last), splitting down the middle so that operands are balanced
+        Nat product_range(std::vector<Nat>& factors, std::size_t first, std::size_t last, std::size_t threads) {
+            if (last - first == 1) { return std::move(factors[first]); }
+            std::size_t middle = first + (last - first) / 2;
+            if (threads > 1) {
+                // the halves touch disjoint factors, so can safely share the vector
+                auto left = std::async(std::launch::async, product_range, std::ref(factors), first, middle, threads / 2);
+                Nat right = product_range(factors, middle, last, threads - threads / 2);
+                return left.get() * right;
+            }
+            return product_range(factors, first, middle, 1) * product_range(factors, middle, last, 1);
+        }
+    }
+
+    namespace {
+        const char DIGIT_CHARACTERS[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        void check_base(int base) {
+            if (base < 2 or base > 36) {
+                throw std::invalid_argument("number base must be from 2 to 36");
+            }
+        }
+
+        // writes value as exactly width digits of base, with leading zeroes
+        void write_chunk(uintmax_t value, std::uint8_t base, std::size_t width, char* out) {
+            for (std::size_t i = width; i-- > 0; ) {
+                out[i] = DIGIT_CHARACTERS[value % base];
+                value /= base;
+            }
+        }
+
+        /*
+         * writes value as exactly chunk × 2ˡᵉᵛᵉˡ digits of base, by splitting it
+         * into halves of equal width with powers[level - 1] and recursing
+         * into each one, until the halves fit in uintmax_t.
+         * The output must already be filled with zeroes.
+         */
+        void write_padded(const Nat& value, std::size_t level, const std::vector<Nat>& powers, std::uint8_t base, std::size_t chunk, char* out) {
+            if (level == 0) {
+                write_chunk((uintmax_t)value, base, chunk, out);
+                return;
+            }
+            // the output is already full of zeroes, so there's nothing to write for them
+            if (not value) { return; }
+            Nat quotient;
+            Nat remainder;
+            divmod(quotient, remainder, value, powers[level - 1]);
+            write_padded(quotient, level - 1, powers, base, chunk, out);
+            write_padded(remainder, level - 1, powers, base, chunk, out + (chunk << (level - 1)));
+        }
+
+        // every byte as its two hexadecimal characters, so hex needs only one lookup per byte
+        constexpr std::array<std::array<char, 2>, 256> HEX_PAIRS = [] {
+            std::array<std::array<char, 2>, 256> pairs = {};
+            for (std::size_t byte = 0; byte < 256; byte++) {
+                pairs[byte] = {DIGIT_CHARACTERS[byte >> 4], DIGIT_CHARACTERS[byte & 0xf]};
+            }
+            return pairs;
+        }();
+
+        /*
+         * writes the given digits of a Nat of length bits in a base of 2ᵇⁱᵗˢ,
+         * by regrouping their bits from the least significant end. Returns
+         * the end of what was written, or nullptr if it doesn't fit before last
+         */
+        char* write_bits(const codlili::list<Nat::StorageType>& digits, std::size_t length, std::size_t bits, char* first, char* last) {
+            std::size_t count = (length + bits - 1) / bits;
+            if ((std::size_t)(last - first) < count) { return nullptr; }
+            Nat::OverflowType mask = ((Nat::OverflowType)1 << bits) - 1;
+            // bits read but not yet written, least significant first
+            Nat::OverflowType buffer = 0;
+            std::size_t buffered = 0;
+            char* out = first + count;
+            for (auto it = digits.rbegin(); it != digits.rend() and out != first; ++it) {
+                buffer |= (Nat::OverflowType)*it << buffered;
+                buffered += std::numeric_limits<Nat::StorageType>::digits;
+                if (bits == 4) {
+                    while (buffered >= 8 and out - first >= 2) {
+                        out -= 2;
+                        std::copy_n(HEX_PAIRS[buffer & 0xff].data(), 2, out);
+                        buffer >>= 8;
+                        buffered -= 8;
+                    }
+                }
+                while (buffered >= bits and out != first) {
+                    *--out = DIGIT_CHARACTERS[buffer & mask];
+                    buffer >>= bits;
+                    buffered -= bits;
+                }
+            }
+            // the most significant character may be made of fewer bits than the rest
+            if (out != first) {
+                *--out = DIGIT_CHARACTERS[buffer & mask];
+            }
+            return first + count;
+        }
+
+        /*
+         * as write_padded(), but without leading zeroes, so only the low half
+         * of each split is padded. Returns the end of what was written, or
+         * nullptr if it doesn't fit before last
+         */
+        char* write_unpadded(const Nat& value, std::size_t level, const std::vector<Nat>& powers, std::uint8_t base, std::size_t chunk, char* out, char* last) {
+            if (level == 0) {
+                auto [end, error] = std::to_chars(out, last, (uintmax_t)value, base);
+                return error == std::errc() ? end : nullptr;
+            }
+            if (value < powers[level - 1]) {
+                return write_unpadded(value, level - 1, powers, base, chunk, out, last);
+            }
+            Nat quotient;
+            Nat remainder;
+            divmod(quotient, remainder, value, powers[level - 1]);
+            out = write_unpadded(quotient, level - 1, powers, base, chunk, out, last);
+            std::size_t width = chunk << (level - 1);
+            if (out == nullptr or (std::size_t)(last - out) < width) { return nullptr; }
+            std::fill(out, out + width, '0');
+            write_padded(remainder, level - 1, powers, base, chunk, out);
+            return out + width;
+        }
+    }
+
+    Nat PRIVATE::product_tree(std::vector<Nat>& factors, std::size_t threads) {
+        if (factors.empty()) { return 1; }
+        if (threads == 0) {
+            threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        return product_range(factors, 0, factors.size(), threads);
+    }
+
     Nat::Nat(std::string digits)
-        // use user-defined-literal to convert the digits in the string
-      : _digits(literals::operator "" _nat(digits.c_str())._digits)
+        // parse the same way as the user-defined-literal does
+      : _digits(PRIVATE::parse_literal(digits.data(), digits.data() + digits.size())._digits)
       {}
 
-    std::string Nat::_stringify_for_base(std::uint8_t base) const {
-        // find out how many digits of the given base can be squeezed into uintmax_t
-        auto [max_possible, discard] = ilog(base, std::numeric_limits<uintmax_t>::max());
-        // we will build up the string using digits of this base, for efficiency
-        const Nat chunk = ipow(base, (uintmax_t)max_possible);
-        Nat value = *this;
-        std::string digits;
-        // build the digits up backwards, least-significant-first up to the most
-        do {
-            std::ostringstream output;
-            auto [quotient, remainder] = divmod(value, chunk);
-            // only pad to width of chunk if this is not the front chunk
-            if (quotient != 0) {
-                output << std::setfill('0') << std::setw((uintmax_t)max_possible);
-            }
-            switch (base) {
-            case 8:
-                output << std::oct;
-                break;
-            case 16:
-                output << std::hex;
-                break;
-            default:
-                output << std::dec;
-                break;
+    std::size_t Nat::chars_needed(int base) const {
+        check_base(base);
+        // a value of n bits has at most n / log₂(base) digits, rounded up, plus one for rounding error in the log
+        return (std::size_t)std::ceil((long double)bit_length() / std::log2((long double)base)) + 1;
+    }
+
+    namespace {
+        void check_layout(std::endian order, std::size_t word_size) {
+            if (word_size == 0) {
+                throw std::invalid_argument("word size cannot be zero");
+            }
+            if (order != std::endian::big and order != std::endian::little) {
+                throw std::invalid_argument("byte order must be big or little endian");
             }
-            output << (uintmax_t)remainder;
-            digits = output.str() + digits;
-            value = quotient;
-        } while (value > 0);
+        }
+    }
+
+    std::size_t Nat::export_bytes(std::span<std::byte> bytes, std::endian order, std::size_t word_size) const {
+        check_layout(order, word_size);
+        std::size_t length = byte_length();
+        std::size_t size = (length + word_size - 1) / word_size * word_size;
+        if (bytes.size() < size) {
+            throw std::length_error("not enough room to export Nat's bytes");
+        }
+        // the zero padding of the most significant word goes at the front for big-endian, the back otherwise
+        std::size_t padding = size - length;
+        std::byte* out = bytes.data();
+        if (order == std::endian::big) {
+            std::fill_n(out, padding, std::byte{0});
+            out += padding + length;
+        } else {
+            std::fill_n(out + length, padding, std::byte{0});
+        }
+        // least significant digit first, moving out towards the most significant byte
+        std::size_t remaining = length;
+        for (auto it = _digits.rbegin(); it != _digits.rend(); ++it) {
+            StorageType digit = *it;
+            std::size_t count = std::min(remaining, sizeof(StorageType));
+            if (order == std::endian::big) {
+                out -= count;
+            }
+            if (count == sizeof(StorageType) and order == std::endian::native) {
+                std::memcpy(out, &digit, sizeof(StorageType));
+            } else {
+                for (std::size_t i = 0; i < count; i++) {
+                    out[order == std::endian::big ? count - 1 - i : i] = (std::byte)(digit >> (8 * i));
+                }
+            }
+            if (order == std::endian::little) {
+                out += count;
+            }
+            remaining -= count;
+        }
+        return size;
+    }
+
+    Nat Nat::import_bytes(std::span<const std::byte> bytes, std::endian order, std::size_t word_size) {
+        check_layout(order, word_size);
+        if (bytes.size() % word_size != 0) {
+            throw std::invalid_argument("bytes must be a whole number of words");
+        }
+        Nat output;
+        if (bytes.empty()) { return output; }
+        codlili::list<StorageType> digits;
+        // least significant digit first, so that each one can be pushed to the front
+        const std::byte* in = order == std::endian::big ? bytes.data() + bytes.size() : bytes.data();
+        for (std::size_t remaining = bytes.size(); remaining > 0; ) {
+            std::size_t count = std::min(remaining, sizeof(StorageType));
+            if (order == std::endian::big) {
+                in -= count;
+            }
+            StorageType digit = 0;
+            if (count == sizeof(StorageType) and order == std::endian::native) {
+                std::memcpy(&digit, in, sizeof(StorageType));
+            } else {
+                for (std::size_t i = 0; i < count; i++) {
+                    digit |= (StorageType)std::to_integer<StorageType>(in[order == std::endian::big ? count - 1 - i : i]) << (8 * i);
+                }
+            }
+            if (order == std::endian::little) {
+                in += count;
+            }
+            digits.push_front(digit);
+            remaining -= count;
+        }
+        output._digits = std::move(digits);
+        output._remove_leading_zeroes();
+        return output;
+    }
+
+    std::to_chars_result to_chars(char* first, char* last, const Nat& value, int base) {
+        check_base(base);
+        if (std::has_single_bit((unsigned)base)) {
+            char* end = write_bits(value._digits, value.bit_length(), (std::size_t)std::countr_zero((unsigned)base), first, last);
+            if (end == nullptr) {
+                return {last, std::errc::value_too_large};
+            }
+            return {end, std::errc()};
+        }
+        // leaves of the recursion are chunks of as many digits of the given base as can be squeezed into uintmax_t
+        std::size_t chunk = PRIVATE::fit(std::numeric_limits<uintmax_t>::max(), (uintmax_t)base) - 1;
+        // each digit of base holds at least this many bits, so we can tell how many levels are needed from bit_length()
+        std::size_t bits = (std::size_t)std::bit_width((unsigned)base) - 1;
+        std::size_t level = 0;
+        while (bits * (chunk << level) < value.bit_length()) {
+            level++;
+        }
+        // powers[i] = base^(chunk × 2ⁱ), so that each level splits its value into two halves of equal width
+        std::vector<Nat> powers;
+        if (level > 0) {
+            powers.push_back(ipow((uintmax_t)base, (uintmax_t)chunk));
+            while (powers.size() < level) {
+                powers.push_back(powers.back() * powers.back());
+            }
+        }
+        char* end = write_unpadded(value, level, powers, (std::uint8_t)base, chunk, first, last);
+        if (end == nullptr) {
+            return {last, std::errc::value_too_large};
+        }
+        return {end, std::errc()};
+    }
+
+    DecimalChunks::DecimalChunks(const Nat& value) {
+        // each decimal digit holds at least 3 bits, so we can tell how many levels are needed from bit_length()
+        std::size_t level = 0;
+        while (3 * (CHUNK << level) < value.bit_length()) {
+            level++;
+        }
+        // values fitting into a single block are written by to_chars(), which doesn't need these
+        if (level > BLOCK_LEVEL) {
+            _powers.push_back(ipow(10, (uintmax_t)CHUNK));
+            while (_powers.size() < level) {
+                _powers.push_back(_powers.back() * _powers.back());
+            }
+        }
+        // every split leaves one frame behind for each level it goes down
+        _stack.reserve(level + 1);
+        _stack.push_back({value, level, false});
+        _advance();
+    }
+
+    void DecimalChunks::_advance() {
+        while (not _stack.empty()) {
+            Frame frame = std::move(_stack.back());
+            _stack.pop_back();
+            if (frame.level <= BLOCK_LEVEL) {
+                if (frame.padded) {
+                    std::fill(_block.begin(), _block.end(), '0');
+                    write_padded(frame.value, BLOCK_LEVEL, _powers, 10, CHUNK, _block.data());
+                    _length = BLOCK_SIZE;
+                } else {
+                    _length = (std::size_t)(to_chars(_block.data(), _block.data() + _block.size(), frame.value).ptr - _block.data());
+                }
+                return;
+            }
+            // without padding, there's nothing to write for the high half if it's zero
+            if (not frame.padded and frame.value < _powers[frame.level - 1]) {
+                _stack.push_back({std::move(frame.value), frame.level - 1, false});
+                continue;
+            }
+            Nat quotient;
+            Nat remainder;
+            divmod(quotient, remainder, frame.value, _powers[frame.level - 1]);
+            // the high half goes on top, as it's written first
+            _stack.push_back({std::move(remainder), frame.level - 1, true});
+            _stack.push_back({std::move(quotient), frame.level - 1, frame.padded});
+        }
+        _length = 0;
+        _done = true;
+    }
+
+    std::from_chars_result from_chars(const char* first, const char* last, Nat& value, int base) {
+        check_base(base);
+        const char* end = first;
+        while (end != last and PRIVATE::digit_value(*end) < base) {
+            end++;
+        }
+        if (end == first) {
+            return {first, std::errc::invalid_argument};
+        }
+        value = PRIVATE::parse_digits(first, end, (std::uint8_t)base, 0);
+        return {end, std::errc()};
+    }
+
+    std::string Nat::_stringify_for_base(std::uint8_t base) const {
+        std::string digits(chars_needed(base), '0');
+        auto [end, error] = to_chars(digits.data(), digits.data() + digits.size(), *this, base);
+        digits.resize((std::size_t)(end - digits.data()));
         return digits;
     }
 
@@ -76,10 +379,66 @@ namespace com::saxbophone::arby {
         } else if (os.flags() & os.oct) {
             base = 8;
         }
-        os << object._stringify_for_base(base);
+        if (base == 10 and os.width() == 0) {
+            // no padding to work out, so digits can go out as they're generated rather than building a string
+            for (std::string_view block : decimal_chunks(object)) {
+                os.write(block.data(), (std::streamsize)block.size());
+            }
+        } else {
+            os << object._stringify_for_base(base);
+        }
         return os;
     }
 
+    /**
+     * @see std::istream& Nat::operator>>(std::istream& is, Nat& object)
+     */
+    std::istream& operator>>(std::istream& is, Nat& object) {
+        std::istream::sentry sentry(is);
+        if (not sentry) { return is; }
+        int base = 10;
+        if (is.flags() & is.hex) {
+            base = 16;
+        } else if (is.flags() & is.oct) {
+            base = 8;
+        }
+        NatParser parser(base);
+        std::streambuf* source = is.rdbuf();
+        std::ios_base::iostate state = std::ios_base::goodbit;
+        // digits are collected here and handed over whenever it fills up
+        char buffer[4096];
+        std::size_t count = 0;
+        bool prefixed = false;
+        for (int c = source->sgetc(); ; c = source->snextc()) {
+            if (c == std::streambuf::traits_type::eof()) {
+                state |= std::ios_base::eofbit;
+                break;
+            }
+            char digit = std::streambuf::traits_type::to_char_type(c);
+            if (base == 16 and not prefixed and count == 1 and parser.size() == 0 and buffer[0] == '0' and (digit == 'x' or digit == 'X')) {
+                // the 0 read so far was the start of a 0x prefix, not a digit
+                prefixed = true;
+                count = 0;
+                continue;
+            }
+            if (PRIVATE::digit_value(digit) >= base) { break; }
+            if (count == sizeof(buffer)) {
+                parser.feed({buffer, count});
+                count = 0;
+            }
+            buffer[count++] = digit;
+        }
+        parser.feed({buffer, count});
+        if (parser.size() == 0) {
+            object = 0;
+            state |= std::ios_base::failbit;
+        } else {
+            object = parser.value();
+        }
+        is.setstate(state);
+        return is;
+    }
+
     Nat::operator std::string() const {
         return this->_stringify_for_base(10);
     }
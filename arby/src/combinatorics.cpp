@@ -0,0 +1,157 @@
+/*
+ * This file forms part of arby
+ * arby is a C++ library providing arbitrary-precision integer types
+ * Warning: arby is alpha-quality software
+ *
+ * Created by Joshua Saxby <joshua.a.saxby@gmail.com>, May 2022
+ *
+ * Copyright Joshua Saxby <joshua.a.saxby@gmail.com> 2022
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <bit>
+#include <limits>
+#include <vector>
+
+#include <arby/Nat.hpp>
+
+
+namespace com::saxbophone::arby {
+    namespace {
+        // all primes up to and including n, by sieve of Eratosthenes over the odd values only
+        std::vector<uintmax_t> primes_up_to(uintmax_t n) {
+            std::vector<uintmax_t> primes;
+            if (n < 2) { return primes; }
+            primes.push_back(2);
+            // composite[i] is for the odd value 2i + 1
+            std::vector<bool> composite((std::size_t)(n / 2 + 1), false);
+            // bounds are written so that nothing can wrap around, even for n close to the maximum
+            for (uintmax_t i = 1; i <= (n - 1) / 2; i++) {
+                if (composite[(std::size_t)i]) { continue; }
+                uintmax_t p = 2 * i + 1;
+                primes.push_back(p);
+                if (p > n / p) { continue; } // p² > n, so no multiples left to cross off
+                for (uintmax_t multiple = p * p; ; multiple += 2 * p) {
+                    composite[(std::size_t)(multiple / 2)] = true;
+                    if (n - multiple < 2 * p) { break; }
+                }
+            }
+            return primes;
+        }
+
+        /*
+         * product of all the given factors, packing as many consecutive
+         * factors as fit into uintmax_t into each leaf of the product tree
+         * so that only the leaves' products need arbitrary precision
+         */
+        Nat product_of(const std::vector<uintmax_t>& factors) {
+            std::vector<Nat> leaves;
+            uintmax_t leaf = 1;
+            for (uintmax_t factor : factors) {
+                if (leaf > std::numeric_limits<uintmax_t>::max() / factor) {
+                    leaves.push_back(leaf);
+                    leaf = 1;
+                }
+                leaf *= factor;
+            }
+            leaves.push_back(leaf);
+            return PRIVATE::product_tree(leaves, 1);
+        }
+
+        // exponent of prime p in n!, by Legendre's formula
+        uintmax_t legendre(uintmax_t n, uintmax_t p) {
+            uintmax_t exponent = 0;
+            while (n >= p) {
+                n /= p;
+                exponent += n;
+            }
+            return exponent;
+        }
+
+        // odd part of the swing number n! / ⌊n/2⌋!², given all primes up to n
+        Nat odd_swing(uintmax_t n, const std::vector<uintmax_t>& primes) {
+            std::vector<uintmax_t> factors;
+            // p appears once for each k where ⌊n / pᵏ⌋ is odd
+            for (std::size_t i = 1; i < primes.size() and primes[i] <= n; i++) {
+                uintmax_t p = primes[i];
+                for (uintmax_t quotient = n / p; quotient > 0; quotient /= p) {
+                    if (quotient & 1) {
+                        factors.push_back(p);
+                    }
+                }
+            }
+            return product_of(factors);
+        }
+
+        // odd part of n!, which is the odd part of ⌊n/2⌋! squared, times the odd swing number
+        Nat odd_factorial(uintmax_t n, const std::vector<uintmax_t>& primes) {
+            if (n < 2) { return 1; }
+            Nat half = odd_factorial(n / 2, primes);
+            return half * half * odd_swing(n, primes);
+        }
+    }
+
+    Nat factorial(uintmax_t n) {
+        // n! has n - popcount(n) factors of 2, by Legendre's formula
+        return odd_factorial(n, primes_up_to(n)) << (n - (uintmax_t)std::popcount(n));
+    }
+
+    Nat binomial(uintmax_t n, uintmax_t k) {
+        if (k > n) { return 0; }
+        if (k > n - k) {
+            k = n - k;
+        }
+        if (k == 0) { return 1; }
+        /*
+         * sieving up to n costs about n / 16 bytes, whereas the result has
+         * roughly k × log₂(n / k) bits. When the sieve would be out of all
+         * proportion to that, divide the falling factorial by k! instead
+         */
+        if (k < n / 32 / (uintmax_t)std::bit_width(n / k)) {
+            std::vector<uintmax_t> factors;
+            factors.reserve((std::size_t)k);
+            for (uintmax_t i = n - k + 1; i <= n and i != 0; i++) {
+                factors.push_back(i);
+            }
+            return product_of(factors) / factorial(k);
+        }
+        std::vector<uintmax_t> factors;
+        uintmax_t twos = 0;
+        for (uintmax_t p : primes_up_to(n)) {
+            // Kummer's theorem: the exponent of p is the number of carries when adding k and n - k in base p
+            uintmax_t exponent = legendre(n, p) - legendre(k, p) - legendre(n - k, p);
+            if (p == 2) {
+                twos = exponent;
+            } else {
+                factors.insert(factors.end(), (std::size_t)exponent, p);
+            }
+        }
+        return product_of(factors) << twos;
+    }
+
+    Nat double_factorial(uintmax_t n) {
+        if (n % 2 == 0) {
+            // n!! = 2ᵐ × m!, for n = 2m
+            return factorial(n / 2) << (n / 2);
+        }
+        // n!! = n! / (2ᵐ × m!), for n = 2m + 1, so odd primes appear as often as in n! but not m!
+        std::vector<uintmax_t> factors;
+        uintmax_t m = n / 2;
+        std::vector<uintmax_t> primes = primes_up_to(n);
+        for (std::size_t i = 1; i < primes.size(); i++) {
+            uintmax_t p = primes[i];
+            factors.insert(factors.end(), (std::size_t)(legendre(n, p) - legendre(m, p)), p);
+        }
+        return product_of(factors);
+    }
+
+    Nat primorial(uintmax_t n) {
+        return product_of(primes_up_to(n));
+    }
+}
@@ -0,0 +1,200 @@
+/*
+ * This file forms part of arby
+ * arby is a C++ library providing arbitrary-precision integer types
+ * Warning: arby is alpha-quality software
+ *
+ * Created by Joshua Saxby <joshua.a.saxby@gmail.com>, May 2022
+ *
+ * Copyright Joshua Saxby <joshua.a.saxby@gmail.com> 2022
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <vector>
+#endif
+
+#include <arby/Nat.hpp>
+
+
+namespace com::saxbophone::arby {
+    namespace {
+        static_assert(
+            std::endian::native == std::endian::big or std::endian::native == std::endian::little,
+            "saving Nat to file is only supported on big or little-endian machines"
+        );
+
+        // layout of the header, as documented on Nat::save()
+        constexpr char MAGIC[8] = {'a', 'r', 'b', 'y', ':', 'N', 'a', 't'};
+        constexpr std::uint8_t VERSION = 1;
+        constexpr std::uint8_t LITTLE_ENDIAN_ORDER = 0;
+        constexpr std::uint8_t BIG_ENDIAN_ORDER = 1;
+        constexpr std::size_t HEADER_SIZE = 24;
+
+        // value stored in the whole contents of a file, after checking its header
+        Nat read_file(std::span<const std::byte> file, const std::filesystem::path& path) {
+            auto invalid = [&](const std::string& reason) {
+                return std::runtime_error("invalid arby::Nat file " + path.string() + ": " + reason);
+            };
+            if (file.size() < HEADER_SIZE or std::memcmp(file.data(), MAGIC, sizeof(MAGIC)) != 0) {
+                throw invalid("missing header");
+            }
+            auto header = [&](std::size_t offset) { return std::to_integer<std::uint8_t>(file[offset]); };
+            if (header(8) != VERSION) {
+                throw invalid("unsupported format version " + std::to_string(header(8)));
+            }
+            std::size_t digit_size = header(9);
+            if (digit_size == 0) {
+                throw invalid("digit size is zero");
+            }
+            if (header(10) != LITTLE_ENDIAN_ORDER and header(10) != BIG_ENDIAN_ORDER) {
+                throw invalid("unknown byte order");
+            }
+            for (std::size_t offset = 11; offset < 16; offset++) {
+                if (header(offset) != 0) {
+                    throw invalid("reserved header bytes are not zero");
+                }
+            }
+            std::uint64_t count = 0;
+            for (std::size_t i = 0; i < 8; i++) {
+                count |= (std::uint64_t)header(16 + i) << (8 * i);
+            }
+            std::size_t body = file.size() - HEADER_SIZE;
+            if (count > body / digit_size or count * digit_size != body) {
+                throw invalid("size doesn't match its number of digits");
+            }
+            return Nat::import_bytes(
+                file.subspan(HEADER_SIZE),
+                header(10) == BIG_ENDIAN_ORDER ? std::endian::big : std::endian::little,
+                digit_size
+            );
+        }
+    }
+
+    void Nat::save(const std::filesystem::path& path) const {
+        // written next to the destination and then renamed over it, so any existing file survives a failed write
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (not file) {
+            throw std::runtime_error("cannot open " + temporary.string() + " for writing");
+        }
+        // removes the temporary file unless it's been renamed into place
+        struct Remover {
+            const std::filesystem::path& path;
+            bool renamed = false;
+            ~Remover() {
+                if (not renamed) {
+                    std::error_code error;
+                    std::filesystem::remove(path, error);
+                }
+            }
+        } remover{temporary};
+        std::array<char, HEADER_SIZE> header = {};
+        std::copy_n(MAGIC, sizeof(MAGIC), header.begin());
+        header[8] = (char)VERSION;
+        header[9] = (char)sizeof(StorageType);
+        header[10] = (char)(std::endian::native == std::endian::big ? BIG_ENDIAN_ORDER : LITTLE_ENDIAN_ORDER);
+        std::uint64_t count = _digits.size();
+        for (std::size_t i = 0; i < 8; i++) {
+            header[16 + i] = (char)(count >> (8 * i));
+        }
+        file.write(header.data(), (std::streamsize)header.size());
+        // digits are collected into batches, so that there isn't a write for every one
+        std::array<StorageType, 8192> batch;
+        std::size_t batched = 0;
+        auto append = [&](StorageType digit) {
+            batch[batched++] = digit;
+            if (batched == batch.size()) {
+                file.write(reinterpret_cast<const char*>(batch.data()), (std::streamsize)(batched * sizeof(StorageType)));
+                batched = 0;
+            }
+        };
+        // in memory, each digit is already in the native byte order, so only the order of the digits depends on it
+        if constexpr (std::endian::native == std::endian::big) {
+            for (StorageType digit : _digits) {
+                append(digit);
+            }
+        } else {
+            for (auto it = _digits.rbegin(); it != _digits.rend(); ++it) {
+                append(*it);
+            }
+        }
+        file.write(reinterpret_cast<const char*>(batch.data()), (std::streamsize)(batched * sizeof(StorageType)));
+        file.close();
+        if (not file) {
+            throw std::runtime_error("failed to write " + temporary.string());
+        }
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        if (error) {
+            throw std::runtime_error("cannot replace " + path.string() + ": " + error.message());
+        }
+        remover.renamed = true;
+    }
+
+    Nat Nat::load(const std::filesystem::path& path) {
+#if __has_include(<sys/mman.h>)
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw std::runtime_error("cannot open " + path.string() + " for reading");
+        }
+        struct stat status;
+        if (::fstat(descriptor, &status) != 0) {
+            ::close(descriptor);
+            throw std::runtime_error("cannot read the size of " + path.string());
+        }
+        std::size_t size = (std::size_t)status.st_size;
+        if (size == 0) { // can't map an empty file, but it's invalid anyway
+            ::close(descriptor);
+            return read_file({}, path);
+        }
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        // the mapping remains valid without the file being open
+        ::close(descriptor);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("cannot map " + path.string() + " into memory");
+        }
+        // unmaps the file however reading it ends
+        struct Unmapper {
+            void* mapping;
+            std::size_t size;
+            ~Unmapper() { ::munmap(mapping, size); }
+        } unmapper{mapping, size};
+        ::posix_madvise(mapping, size, POSIX_MADV_SEQUENTIAL);
+        return read_file({static_cast<const std::byte*>(mapping), size}, path);
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (not file) {
+            throw std::runtime_error("cannot open " + path.string() + " for reading");
+        }
+        std::vector<std::byte> contents((std::size_t)file.tellg());
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(contents.data()), (std::streamsize)contents.size());
+        if (not file) {
+            throw std::runtime_error("failed to read " + path.string());
+        }
+        return read_file(contents, path);
+#endif
+    }
+}
@@ -0,0 +1,102 @@
+#include <cstdint>
+
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <arby/Accumulator.hpp>
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+
+TEST_CASE("Default-constructed arby::Accumulator has value zero", "[accumulator]") {
+    arby::Accumulator total;
+
+    CHECK(total.value() == 0);
+    CHECK(total.value().digit_length() == 1);
+}
+
+TEST_CASE("arby::Accumulator constructed from a value has that value", "[accumulator]") {
+    uintmax_t value = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    arby::Accumulator total = arby::Nat(value);
+
+    CHECK((arby::Nat)total == value);
+}
+
+TEST_CASE("arby::Accumulator sums values of mixed sizes", "[accumulator]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::uniform_int_distribution<std::size_t> sizes(1, 20);
+    arby::Accumulator total;
+    arby::Nat expected;
+    for (int i = 0; i < 100; i++) {
+        arby::Nat value = random_nat(engine, sizes(engine));
+        total += value;
+        expected += value;
+    }
+
+    CHECK(total.value() == expected);
+}
+
+TEST_CASE("arby::Accumulator carries out of every digit position", "[accumulator]") {
+    // every digit at its maximum, so every counter carries into the next
+    arby::Nat value = (arby::Nat(1) << 256) - 1;
+    arby::Accumulator total;
+    for (int i = 0; i < 10000; i++) {
+        total += value;
+    }
+
+    CHECK(total.value() == value * 10000);
+}
+
+TEST_CASE("arby::Accumulator value can be read part-way through summing", "[accumulator]") {
+    arby::Accumulator total = arby::Nat(5);
+    CHECK(total.value() == 5);
+    total += arby::Nat(std::numeric_limits<uintmax_t>::max());
+    CHECK(total.value() == arby::Nat(std::numeric_limits<uintmax_t>::max()) + 5);
+    total += 0;
+    CHECK(total.value() == arby::Nat(std::numeric_limits<uintmax_t>::max()) + 5);
+}
+
+TEST_CASE("arby::sum() of a range", "[accumulator]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::vector<arby::Nat> values;
+    for (int i = 0; i < 50; i++) {
+        values.push_back(random_nat(engine, 8));
+    }
+
+    CHECK(arby::sum(values.begin(), values.end()) == std::accumulate(values.begin(), values.end(), arby::Nat(0)));
+}
+
+TEST_CASE("arby::sum() of a range with initial value", "[accumulator]") {
+    std::vector<uintmax_t> values = {1, 2, 3, std::numeric_limits<uintmax_t>::max()};
+
+    CHECK(arby::sum(values.begin(), values.end(), 10) == arby::Nat(std::numeric_limits<uintmax_t>::max()) + 16);
+}
+
+TEST_CASE("arby::sum() of an empty range is the initial value", "[accumulator]") {
+    std::vector<arby::Nat> values;
+
+    CHECK(arby::sum(values.begin(), values.end()) == 0);
+    CHECK(arby::sum(values.begin(), values.end(), 42) == 42);
+}
+
+TEST_CASE("Benchmark arby::Accumulator against repeated addition", "[.][benchmark]") {
+    std::mt19937 engine(42);
+    std::vector<arby::Nat> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(random_nat(engine, 64));
+    }
+
+    BENCHMARK("arby::sum()") {
+        return arby::sum(values.begin(), values.end());
+    };
+    BENCHMARK("std::accumulate()") {
+        return std::accumulate(values.begin(), values.end(), arby::Nat(0));
+    };
+}
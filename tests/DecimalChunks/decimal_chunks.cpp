@@ -0,0 +1,70 @@
+#include <cstddef>
+
+#include <iterator>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <arby/DecimalChunks.hpp>
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+
+static_assert(std::input_iterator<arby::DecimalChunks::iterator>);
+static_assert(std::ranges::input_range<arby::DecimalChunks>);
+
+TEST_CASE("arby::decimal_chunks() of zero is the single block 0", "[decimal-chunks]") {
+    std::vector<std::string> blocks;
+    for (std::string_view block : arby::decimal_chunks(0)) {
+        blocks.emplace_back(block);
+    }
+
+    CHECK(blocks == std::vector<std::string>{"0"});
+}
+
+TEST_CASE("arby::decimal_chunks() blocks joined together are the decimal string", "[decimal-chunks]") {
+    std::mt19937 engine(GENERATE(1u, 2u, 3u));
+    arby::Nat value = random_nat(engine, GENERATE(1u, 2u, 100u, 127u, 128u, 1000u));
+    std::string joined;
+    std::size_t count = 0;
+    for (std::string_view block : arby::decimal_chunks(value)) {
+        // only the first block may be shorter, and it has no leading zero
+        if (count++ == 0) {
+            CHECK(block.size() <= arby::DecimalChunks::BLOCK_SIZE);
+            CHECK(block.front() != '0');
+        } else {
+            CHECK(block.size() == arby::DecimalChunks::BLOCK_SIZE);
+        }
+        joined += block;
+    }
+
+    CHECK(joined == (std::string)value);
+}
+
+TEST_CASE("arby::decimal_chunks() keeps runs of zeroes spanning whole blocks", "[decimal-chunks]") {
+    std::size_t zeroes = GENERATE(arby::DecimalChunks::BLOCK_SIZE * 3, arby::DecimalChunks::BLOCK_SIZE * 5 + 7);
+    arby::Nat value = arby::ipow(10, zeroes) + 1;
+    std::string joined;
+    for (std::string_view block : arby::decimal_chunks(value)) {
+        joined += block;
+    }
+
+    CHECK(joined == "1" + std::string(zeroes - 1, '0') + "1");
+}
+
+TEST_CASE("Using std::ostream << arby::Nat streams the same digits as to std::string", "[decimal-chunks]") {
+    std::mt19937 engine(GENERATE(4u, 5u));
+    arby::Nat value = random_nat(engine, GENERATE(1u, 300u));
+    std::ostringstream stream;
+    stream << value;
+
+    CHECK(stream.str() == (std::string)value);
+}
@@ -0,0 +1,159 @@
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <arby/Expression.hpp>
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+using arby::lazy;
+
+TEST_CASE("arby::lazy() of a value evaluates to that value", "[expression]") {
+    uintmax_t value = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    arby::Nat original = value;
+    arby::Nat result = lazy(original);
+
+    CHECK(result == value);
+}
+
+TEST_CASE("Lazy sum of products matches eager evaluation", "[expression]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    arby::Nat a = random_nat(engine, 6);
+    arby::Nat b = random_nat(engine, 3);
+    arby::Nat c = random_nat(engine, 5);
+    arby::Nat d = random_nat(engine, 4);
+    arby::Nat e = random_nat(engine, 2);
+
+    arby::Nat result = lazy(a) * b + lazy(c) * d - e;
+
+    CHECK(result == a * b + c * d - e);
+}
+
+TEST_CASE("Lazy shift-or matches eager evaluation", "[expression]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    arby::Nat x = random_nat(engine, 3);
+    arby::Nat y = random_nat(engine, 4);
+    uintmax_t shift = GENERATE(0u, 3u, 32u, 45u);
+
+    arby::Nat result = (lazy(x) << shift) | y;
+
+    CHECK(result == ((x << shift) | y));
+}
+
+TEST_CASE("Lazy bitwise and shift operators match eager evaluation", "[expression]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    arby::Nat x = random_nat(engine, 4);
+    arby::Nat y = random_nat(engine, 3);
+
+    CHECK((arby::Nat)(lazy(x) & y) == (x & y));
+    CHECK((arby::Nat)(lazy(x) ^ y) == (x ^ y));
+    CHECK((arby::Nat)(lazy(x) >> 40) == (x >> 40));
+    CHECK((arby::Nat)((lazy(x) + y) >> 7) == ((x + y) >> 7));
+    CHECK((arby::Nat)(x - (lazy(y) << 5)) == (x - (y << 5)));
+}
+
+TEST_CASE("Lazy expressions accept integer operands", "[expression]") {
+    arby::Nat x = arby::Nat(1) << 100;
+
+    CHECK((arby::Nat)(lazy(x) + 5) == x + 5);
+    CHECK((arby::Nat)(3 * lazy(x) - 1) == x * 3 - 1);
+    CHECK((arby::Nat)((lazy(x) >> 90) | 1) == 1025);
+}
+
+TEST_CASE("Lazy expressions compare with Nat by evaluating", "[expression]") {
+    arby::Nat x = 1000;
+    arby::Nat y = 7;
+
+    CHECK(lazy(x) * y == 7000);
+    CHECK(lazy(x) - y < x);
+}
+
+TEST_CASE("Lazy expression underflows exactly when eager evaluation would", "[expression]") {
+    arby::Nat a = 10;
+    arby::Nat b = 20;
+    arby::Nat c = 15;
+
+    CHECK_THROWS_AS((arby::Nat)(lazy(a) - b + c), std::underflow_error);
+    // b - c fits within a, so the subtraction as a whole is fine even though a - b isn't
+    CHECK((arby::Nat)(lazy(a) - (lazy(b) - c)) == 5);
+    CHECK((arby::Nat)(lazy(c) - (lazy(a) + 5)) == 0);
+    CHECK_THROWS_AS((arby::Nat)(lazy(a) - (lazy(c) - 1)), std::underflow_error);
+    CHECK_THROWS_AS((arby::Nat)(lazy(a) * b - lazy(c) * c), std::underflow_error);
+}
+
+TEST_CASE("Lazy difference underflows when added to something, even if the total wouldn't", "[expression]") {
+    arby::Nat a = 10;
+    arby::Nat b = 1;
+    arby::Nat c = 5;
+    arby::Nat r = 10;
+
+    CHECK_THROWS_AS((arby::Nat)(lazy(a) + (lazy(b) - c)), std::underflow_error);
+    CHECK_THROWS_AS(r += lazy(b) - c, std::underflow_error);
+}
+
+TEST_CASE("Compound assignment of lazy expressions", "[expression]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    arby::Nat a = random_nat(engine, 5);
+    arby::Nat b = random_nat(engine, 3);
+    arby::Nat c = random_nat(engine, 2);
+    arby::Nat accumulator = random_nat(engine, 10);
+    arby::Nat expected = accumulator;
+
+    accumulator += lazy(a) * b + c;
+    expected += a * b + c;
+    CHECK(accumulator == expected);
+    accumulator -= lazy(a) * c + b;
+    expected -= a * c + b;
+    CHECK(accumulator == expected);
+}
+
+TEST_CASE("Compound assignment of lazy expressions referring to the destination", "[expression]") {
+    arby::Nat a = 100;
+    arby::Nat b = 3;
+
+    SECTION("Addition") {
+        a += lazy(b) + a;
+        CHECK(a == 203);
+    }
+    SECTION("Fused multiply-add") {
+        a += lazy(a) * b;
+        CHECK(a == 400);
+    }
+    SECTION("Subtraction") {
+        a -= lazy(a) - b;
+        CHECK(a == 3);
+    }
+}
+
+TEST_CASE("Lazy expression assigned to one of its own operands", "[expression]") {
+    arby::Nat a = 100;
+    arby::Nat b = 3;
+
+    a = lazy(a) * b + a;
+
+    CHECK(a == 400);
+}
+
+TEST_CASE("Benchmark lazy against eager sum of products", "[.][benchmark]") {
+    std::mt19937 engine(42);
+    arby::Nat a = random_nat(engine, 64);
+    arby::Nat b = random_nat(engine, 64);
+    arby::Nat c = random_nat(engine, 64);
+    arby::Nat d = random_nat(engine, 64);
+    arby::Nat e = random_nat(engine, 64);
+
+    BENCHMARK("lazy") {
+        return (arby::Nat)(lazy(a) * b + lazy(c) * d - e);
+    };
+    BENCHMARK("eager") {
+        return a * b + c * d - e;
+    };
+}
@@ -0,0 +1,54 @@
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <arby/GcdResult.hpp>
+#include <arby/Nat.hpp>
+
+using namespace com::saxbophone;
+
+TEMPLATE_TEST_CASE("default GcdResult", "[gcd-result]", int, unsigned long, arby::Nat) {
+    arby::GcdResult<TestType> def;
+
+    CHECK(def.gcd == 0);
+    CHECK(def.x == 0);
+    CHECK(def.y == 0);
+}
+
+TEMPLATE_TEST_CASE("GcdResult from gcd,x,y", "[gcd-result]", int, unsigned long, arby::Nat) {
+    arby::GcdResult<TestType> input(12, 76, 31);
+
+    CHECK(input.gcd == 12);
+    CHECK(input.x == 76);
+    CHECK(input.y == 31);
+}
+
+TEMPLATE_TEST_CASE("Structured binding from GcdResult", "[gcd-result]", int, unsigned long, arby::Nat) {
+    arby::GcdResult<TestType> input(7, 99, 133);
+
+    auto [gcd, x, y] = input;
+
+    CHECK(gcd == 7);
+    CHECK(x == 99);
+    CHECK(y == 133);
+}
+
+TEST_CASE("GcdResult<T> can be cast to GcdResult<U> where (T)U is valid", "[gcd-result]") {
+    using T = unsigned int;
+    using U = long;
+
+    arby::GcdResult<T> input(3, 987, 232);
+
+    arby::GcdResult<U> output = input;
+
+    CHECK(output.gcd == 3);
+    CHECK(output.x == 987);
+    CHECK(output.y == 232);
+}
+
+TEST_CASE("GcdResult can be compared to GcdResult", "[gcd-result]") {
+    arby::GcdResult<int> a(1, 64, 23);
+    arby::GcdResult<int> b = a;
+
+    CHECK(a == b);
+}
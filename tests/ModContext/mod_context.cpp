@@ -0,0 +1,80 @@
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <arby/ModContext.hpp>
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+
+TEST_CASE("arby::ModContext with zero modulus throws std::domain_error", "[mod-context]") {
+    CHECK_THROWS_AS(arby::ModContext(0), std::domain_error);
+}
+
+TEST_CASE("arby::ModContext.modulus() returns the modulus it was constructed with", "[mod-context]") {
+    uintmax_t modulus = GENERATE(take(10, random((uintmax_t)1, std::numeric_limits<uintmax_t>::max())));
+
+    CHECK(arby::ModContext(modulus).modulus() == modulus);
+}
+
+TEST_CASE("arby::ModContext operations agree with plain arithmetic then modulo", "[mod-context]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t digits = GENERATE((std::size_t)1, (std::size_t)3, (std::size_t)6);
+    arby::Nat modulus = random_nat(engine, digits);
+    // covers both odd and even moduli
+    bool odd = GENERATE(false, true);
+    modulus = odd ? modulus | 1 : modulus - (modulus & 1);
+    if (modulus == 0) { modulus = 2; }
+    // operands smaller than, near to and larger than the modulus, up to more than twice its size
+    std::size_t a_digits = GENERATE_COPY((std::size_t)1, digits, 2 * digits + 1);
+    arby::Nat a = random_nat(engine, a_digits);
+    arby::Nat b = random_nat(engine, digits);
+    arby::ModContext context(modulus);
+
+    CAPTURE(modulus, a, b);
+
+    CHECK(context.reduce(a) == a % modulus);
+    CHECK(context.addmod(a, b) == (a + b) % modulus);
+    CHECK(context.submod(a, b) == (a % modulus + modulus - b % modulus) % modulus);
+    CHECK(context.submod(b, a) == (b % modulus + modulus - a % modulus) % modulus);
+    CHECK(context.mulmod(a, b) == (a * b) % modulus);
+    CHECK(context.sqrmod(b) == (b * b) % modulus);
+}
+
+TEST_CASE("arby::ModContext with modulus of 1 always gives zero", "[mod-context]") {
+    uintmax_t a = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t b = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    arby::ModContext context(1);
+
+    CHECK(context.reduce(a) == 0);
+    CHECK(context.addmod(a, b) == 0);
+    CHECK(context.submod(a, b) == 0);
+    CHECK(context.mulmod(a, b) == 0);
+    CHECK(context.sqrmod(a) == 0);
+    CHECK(arby::powmod(a, b, context) == 0);
+}
+
+TEST_CASE("arby::powmod() with ModContext gives same result as without", "[mod-context][powmod]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t digits = GENERATE((std::size_t)1, (std::size_t)2, (std::size_t)4);
+    arby::Nat base = random_nat(engine, digits + 1);
+    arby::Nat exponent = random_nat(engine, 1);
+    arby::Nat modulus = random_nat(engine, digits);
+    // one context reused for both moduli parities and many exponentiations
+    arby::ModContext odd(modulus | 1);
+    arby::ModContext even(modulus + (modulus & 1));
+
+    CAPTURE(base, exponent, modulus);
+
+    CHECK(arby::powmod(base, exponent, odd) == arby::powmod(base, exponent, modulus | 1));
+    CHECK(arby::powmod(base, exponent, even) == arby::powmod(base, exponent, modulus + (modulus & 1)));
+    CHECK(arby::powmod(base, 0, odd) == 1);
+    CHECK(arby::powmod(base, 0, even) == 1);
+}
@@ -0,0 +1,115 @@
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+
+TEST_CASE("arby::addmul() gives same result as adding the product", "[math-support][addmul]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t acc_digits = GENERATE((std::size_t)1, (std::size_t)3, (std::size_t)12);
+    std::size_t a_digits = GENERATE((std::size_t)1, (std::size_t)4);
+    std::size_t b_digits = GENERATE((std::size_t)1, (std::size_t)2, (std::size_t)7);
+    arby::Nat acc = random_nat(engine, acc_digits);
+    arby::Nat a = random_nat(engine, a_digits);
+    arby::Nat b = random_nat(engine, b_digits);
+    arby::Nat expected = acc + a * b;
+
+    arby::addmul(acc, a, b);
+
+    CHECK(acc == expected);
+}
+
+TEST_CASE("arby::addmul() with zero operands", "[math-support][addmul]") {
+    uintmax_t value = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    arby::Nat acc = value;
+
+    arby::addmul(acc, 0, value);
+    arby::addmul(acc, value, 0);
+
+    CHECK(acc == value);
+}
+
+TEST_CASE("arby::submul() gives same result as subtracting the product", "[math-support][submul]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t a_digits = GENERATE((std::size_t)1, (std::size_t)4);
+    std::size_t b_digits = GENERATE((std::size_t)1, (std::size_t)2, (std::size_t)7);
+    arby::Nat a = random_nat(engine, a_digits);
+    arby::Nat b = random_nat(engine, b_digits);
+    arby::Nat difference = random_nat(engine, GENERATE((std::size_t)1, (std::size_t)3, (std::size_t)12));
+    arby::Nat acc = a * b + difference;
+
+    arby::submul(acc, a, b);
+
+    CHECK(acc == difference);
+}
+
+TEST_CASE("arby::submul() down to exactly zero", "[math-support][submul]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    arby::Nat a = random_nat(engine, 3);
+    arby::Nat b = random_nat(engine, 5);
+    arby::Nat acc = a * b;
+
+    arby::submul(acc, a, b);
+
+    CHECK(acc == 0);
+}
+
+TEST_CASE("arby::submul() with product bigger than accumulator throws std::underflow_error and leaves it unchanged", "[math-support][submul]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    arby::Nat a = random_nat(engine, GENERATE((std::size_t)1, (std::size_t)3));
+    arby::Nat b = random_nat(engine, GENERATE((std::size_t)1, (std::size_t)5));
+    // only just too small, so that the underflow isn't found until the last row
+    arby::Nat shortfall = GENERATE((uintmax_t)1, (uintmax_t)1000);
+    arby::Nat acc = a * b > shortfall ? a * b - shortfall : 0;
+    arby::Nat original = acc;
+
+    CHECK_THROWS_AS(arby::submul(acc, a, b), std::underflow_error);
+    CHECK(acc == original);
+}
+
+TEST_CASE("arby::addmul() and arby::submul() with aliased arguments", "[math-support][addmul][submul]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    arby::Nat x = random_nat(engine, 4);
+    arby::Nat y = random_nat(engine, 2);
+    arby::Nat original = x;
+
+    arby::addmul(x, x, x);
+    CHECK(x == original + original * original);
+
+    x = original;
+    arby::addmul(x, x, y);
+    CHECK(x == original + original * y);
+
+    x = original * y + original;
+    arby::submul(x, y, x - original * y);
+    CHECK(x == original);
+}
+
+TEST_CASE("arby::addmul_ui() and arby::submul_ui()", "[math-support][addmul][submul]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    uintmax_t k = GENERATE(take(5, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    arby::Nat acc = random_nat(engine, 6);
+    arby::Nat a = random_nat(engine, 4);
+    arby::Nat original = acc;
+
+    arby::addmul_ui(acc, a, k);
+    CHECK(acc == original + a * k);
+
+    arby::submul_ui(acc, a, k);
+    CHECK(acc == original);
+
+    if (k > 0) {
+        arby::Nat small = a * k - 1;
+        CHECK_THROWS_AS(arby::submul_ui(small, a, k), std::underflow_error);
+        CHECK(small == a * k - 1);
+    }
+}
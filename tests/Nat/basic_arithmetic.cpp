@@ -74,6 +74,45 @@ TEST_CASE("arby::Nat(std::string)", "[ctor]") {
     CHECK((uintmax_t)object == value);
 }
 
+TEST_CASE("arby::Nat(std::string) with many digits", "[ctor]") {
+    // long enough to be split into chunks several levels deep
+    std::size_t length = GENERATE(19u, 20u, 38u, 39u, 77u, 500u, 1234u);
+    std::string nines(length, '9');
+    std::string power = "1" + std::string(length, '0');
+
+    CHECK(arby::Nat(nines) == arby::ipow(10, length) - 1);
+    CHECK(arby::Nat(power) == arby::ipow(10, length));
+}
+
+TEST_CASE("arby::Nat(std::string) with hexadecimal and binary prefixes", "[ctor]") {
+    CHECK(arby::Nat("0x123456789abcdef0123456789ABCDEF") == (arby::Nat(0x123456789abcdef0) << 60) + 0x123456789ABCDEF);
+    CHECK(arby::Nat("0b" + std::string(100, '1')) == (arby::Nat(1) << 100) - 1);
+}
+
+TEST_CASE("arby::Nat(std::string) with invalid characters throws std::invalid_argument", "[ctor]") {
+    auto [string, message] = GENERATE(
+        table<std::string, std::string>(
+            {
+                {"12a4", "invalid digit 'a' at position 2 for base 10"},
+                {"-1", "invalid digit '-' at position 0 for base 10"},
+                {"123 ", "invalid digit ' ' at position 3 for base 10"},
+                {"0x12g", "invalid digit 'g' at position 4 for base 16"},
+                {"0b1012", "invalid digit '2' at position 5 for base 2"},
+                {std::string(100, '1') + "_", "invalid digit '_' at position 100 for base 10"},
+            }
+        )
+    );
+
+    CHECK_THROWS_WITH(arby::Nat(string), message);
+    CHECK_THROWS_AS(arby::Nat(string), std::invalid_argument);
+}
+
+TEST_CASE("arby::Nat(std::string) with no digits throws std::invalid_argument", "[ctor]") {
+    std::string string = GENERATE("", "0x", "0b");
+
+    CHECK_THROWS_AS(arby::Nat(string), std::invalid_argument);
+}
+
 TEST_CASE("constexpr arby::Nat", "[constexpr]") {
     WARN("No constexpr tests written yet");
 }
@@ -15,6 +15,7 @@ TEST_CASE("arby::Nat left bit-shift", "[bit-shifting]") {
             {
                 {0b1110101_nat, 23, 0b111010100000000000000000000000_nat},
                 {0b0_nat, 13, 0b0_nat},
+                {0b0_nat, 96, 0b0_nat},
                 {0b1101_nat, 1, 0b11010_nat},
                 {0b10001011_nat, 0, 0b10001011_nat},
                 {0b10101110001_nat, 4, 0b101011100010000_nat},
@@ -35,6 +36,7 @@ TEST_CASE("arby::Nat left bit-shift assignment", "[bit-shifting]") {
             {
                 {0b1110101_nat, 23, 0b111010100000000000000000000000_nat},
                 {0b0_nat, 13, 0b0_nat},
+                {0b0_nat, 96, 0b0_nat},
                 {0b1101_nat, 1, 0b11010_nat},
                 {0b10001011_nat, 0, 0b10001011_nat},
                 {0b10101110001_nat, 4, 0b101011100010000_nat},
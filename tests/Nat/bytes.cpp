@@ -0,0 +1,108 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+using namespace com::saxbophone::arby::literals;
+
+static std::vector<std::byte> bytes_of(std::initializer_list<unsigned> values) {
+    std::vector<std::byte> bytes;
+    for (unsigned value : values) {
+        bytes.push_back((std::byte)value);
+    }
+    return bytes;
+}
+
+TEST_CASE("arby::Nat::export_bytes() writes big and little-endian bytes, padded to whole words", "[bytes]") {
+    auto [value, order, word_size, expected] = GENERATE(
+        table<arby::Nat, std::endian, std::size_t, std::vector<std::byte>>(
+            {
+                {0, std::endian::big, 1, bytes_of({0x00})},
+                {0x01, std::endian::little, 4, bytes_of({0x01, 0x00, 0x00, 0x00})},
+                {0x0102030405_nat, std::endian::big, 1, bytes_of({0x01, 0x02, 0x03, 0x04, 0x05})},
+                {0x0102030405_nat, std::endian::little, 1, bytes_of({0x05, 0x04, 0x03, 0x02, 0x01})},
+                {0x0102030405_nat, std::endian::big, 4, bytes_of({0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05})},
+                {0x0102030405_nat, std::endian::little, 8, bytes_of({0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00})},
+                {
+                    0x0102030405060708090a0b0c0d0e0f_nat, std::endian::big, 2,
+                    bytes_of({0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f})
+                },
+            }
+        )
+    );
+    std::vector<std::byte> bytes(expected.size() + 3, (std::byte)0xaa);
+
+    CHECK(value.export_bytes(bytes, order, word_size) == expected.size());
+    CHECK(std::equal(expected.begin(), expected.end(), bytes.begin()));
+    // bytes after the ones written are left alone
+    CHECK(std::all_of(bytes.begin() + (std::ptrdiff_t)expected.size(), bytes.end(), [](std::byte b) { return b == (std::byte)0xaa; }));
+}
+
+TEST_CASE("arby::Nat::import_bytes() reads big and little-endian bytes", "[bytes]") {
+    auto [bytes, order, word_size, expected] = GENERATE(
+        table<std::vector<std::byte>, std::endian, std::size_t, arby::Nat>(
+            {
+                {bytes_of({}), std::endian::big, 1, 0},
+                {bytes_of({0x00, 0x00, 0x00}), std::endian::little, 1, 0},
+                {bytes_of({0x01, 0x02, 0x03, 0x04, 0x05}), std::endian::big, 1, 0x0102030405_nat},
+                {bytes_of({0x01, 0x02, 0x03, 0x04, 0x05}), std::endian::little, 5, 0x0504030201_nat},
+                {bytes_of({0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee}), std::endian::big, 4, 0xffee_nat},
+            }
+        )
+    );
+
+    CHECK(arby::Nat::import_bytes(bytes, order, word_size) == expected);
+}
+
+TEST_CASE("arby::Nat::import_bytes() round-trips arby::Nat::export_bytes()", "[bytes]") {
+    std::mt19937 engine(GENERATE(1u, 2u, 3u));
+    arby::Nat value = random_nat(engine, GENERATE(1u, 2u, 9u, 100u)) >> GENERATE(0u, 8u, 20u);
+    std::endian order = GENERATE(std::endian::big, std::endian::little);
+    std::size_t word_size = GENERATE(1u, 3u, 4u, 8u);
+    std::vector<std::byte> bytes((value.byte_length() / word_size + 1) * word_size);
+    std::size_t size = value.export_bytes(bytes, order, word_size);
+
+    CHECK(size % word_size == 0);
+    CHECK(size < value.byte_length() + word_size);
+    CHECK(arby::Nat::import_bytes(std::span(bytes).first(size), order, word_size) == value);
+}
+
+TEST_CASE("arby::Nat::export_bytes() big-endian agrees with hexadecimal digits", "[bytes]") {
+    arby::Nat value = 0xfedcba9876543210fedcba9876543210f_nat;
+    std::vector<std::byte> bytes(value.byte_length());
+    value.export_bytes(bytes);
+    arby::Nat rebuilt = 0;
+    for (std::byte b : bytes) {
+        rebuilt = (rebuilt << 8) + std::to_integer<unsigned>(b);
+    }
+
+    CHECK(rebuilt == value);
+}
+
+TEST_CASE("arby::Nat::export_bytes() throws std::length_error when there isn't room", "[bytes]") {
+    arby::Nat value = 0x0102030405_nat;
+    std::vector<std::byte> bytes(7);
+
+    CHECK_THROWS_AS(value.export_bytes(bytes, std::endian::big, 4), std::length_error);
+    CHECK_THROWS_AS(value.export_bytes(std::span(bytes).first(4)), std::length_error);
+}
+
+TEST_CASE("arby::Nat::export_bytes() and arby::Nat::import_bytes() reject invalid word sizes", "[bytes]") {
+    std::vector<std::byte> bytes(6);
+
+    CHECK_THROWS_AS(arby::Nat(1).export_bytes(bytes, std::endian::big, 0), std::invalid_argument);
+    CHECK_THROWS_AS(arby::Nat::import_bytes(bytes, std::endian::big, 0), std::invalid_argument);
+    CHECK_THROWS_AS(arby::Nat::import_bytes(bytes, std::endian::big, 4), std::invalid_argument);
+}
@@ -28,6 +28,77 @@ TEMPLATE_TEST_CASE("Casting arby::Nat to various floating-point types", "[castin
     CHECK((TestType)arby::Nat::from_float((TestType)value) == (TestType)value);
 }
 
+TEMPLATE_TEST_CASE("Casting arby::Nat to floating-point types rounds the same as casting uintmax_t", "[casting]", float, double, long double) {
+    auto value = GENERATE(take(1000, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+
+    CHECK((TestType)arby::Nat(value) == (TestType)value);
+}
+
+TEST_CASE("Casting arby::Nat to double rounds to nearest, ties to even", "[casting]") {
+    arby::Nat two_53 = arby::Nat(1) << 53;
+    auto [value, expected] = GENERATE_COPY(
+        table<arby::Nat, double>(
+            {
+                {two_53 + 1, 0x1p53}, // tie, rounds down to even
+                {two_53 + 3, 0x1p53 + 4}, // tie, rounds up to even
+                {((two_53 + 1) << 100), 0x1p153}, // tie far below the leading digits
+                {((two_53 + 1) << 100) + 1, 0x1p153 + 0x1p101}, // just above the tie, only told apart by the last digit
+                {((two_53 + 3) << 100) - 1, 0x1p153 + 0x1p101}, // just below the tie
+                {(arby::Nat(1) << 1000) - 1, 0x1p1000}, // rounds up to the next power of two
+            }
+        )
+    );
+
+    CHECK((double)value == expected);
+}
+
+TEST_CASE("Casting arby::Nat beyond the range of double gives infinity", "[casting]") {
+    CHECK((double)(arby::Nat(1) << 1024) == std::numeric_limits<double>::infinity());
+    CHECK((double)(arby::Nat(1) << 100000) == std::numeric_limits<double>::infinity());
+    CHECK((float)(arby::Nat(1) << 128) == std::numeric_limits<float>::infinity());
+}
+
+TEST_CASE("arby::Nat::to_double_2exp() splits the value into mantissa and exponent", "[casting]") {
+    auto [value, mantissa, exponent] = GENERATE(
+        table<arby::Nat, double, uintmax_t>(
+            {
+                {0, 0.0, 0},
+                {1, 0.5, 1},
+                {12, 0.75, 4},
+                {arby::Nat(3) << 5000, 0.75, 5002},
+                {(arby::Nat(1) << 100000) - 1, 0.5, 100001},
+                {(arby::Nat(1) << 1024) + (arby::Nat(1) << 1000), 0.5 + 0x1p-25, 1025},
+            }
+        )
+    );
+
+    auto result = value.to_double_2exp();
+    CHECK(result.first == mantissa);
+    CHECK(result.second == exponent);
+}
+
+TEST_CASE("arby::Nat::from_float() is exact for large values", "[casting]") {
+    auto [value, expected] = GENERATE(
+        table<long double, arby::Nat>(
+            {
+                {0x1p1000L, arby::Nat(1) << 1000},
+                {0x1.8p200L, arby::Nat(3) << 199},
+                {0x1.000002p100L, (arby::Nat(1) << 100) + (arby::Nat(1) << 77)},
+                {12345.75L, 12345},
+                {4294967296.5L, 4294967296},
+            }
+        )
+    );
+
+    CHECK(arby::Nat::from_float(value) == expected);
+}
+
+TEST_CASE("Casting arby::Nat::from_float() of double back to double gives the same value", "[casting]") {
+    double value = std::ldexp(GENERATE(take(100, random(1.0, 2.0))), GENERATE(0, 30, 52, 53, 64, 500, 1000));
+
+    CHECK((double)arby::Nat::from_float(value) == std::trunc(value));
+}
+
 TEMPLATE_TEST_CASE(
     "Casting arby::Nat with value higher than max to other type throws range_error", "[casting]",
     std::uint8_t, std::int8_t, std::uint16_t, std::int16_t, std::uint32_t, std::int32_t
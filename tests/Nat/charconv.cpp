@@ -0,0 +1,150 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+using namespace com::saxbophone::arby::literals;
+
+TEST_CASE("arby::to_chars() writes the same digits as std::to_chars() for values of uintmax_t", "[charconv]") {
+    uintmax_t value = GENERATE(0u, 1u, 35u, 36u, 1000u, 123456789u, 0xffffffffu, std::numeric_limits<uintmax_t>::max());
+    int base = GENERATE(2, 3, 8, 10, 16, 36);
+    char expected[70] = {};
+    auto [expected_end, expected_error] = std::to_chars(expected, expected + sizeof(expected), value, base);
+    REQUIRE(expected_error == std::errc());
+    char buffer[70] = {};
+    auto [end, error] = arby::to_chars(buffer, buffer + sizeof(buffer), arby::Nat(value), base);
+    CHECK(error == std::errc());
+    CHECK(std::string(buffer, end) == std::string(expected, expected_end));
+}
+
+TEST_CASE("arby::to_chars() of large values agrees with std::ostream << arby::Nat", "[charconv]") {
+    std::mt19937 engine(GENERATE(1u, 2u, 3u));
+    arby::Nat value = random_nat(engine, GENERATE(2u, 17u, 100u));
+    std::string buffer(value.chars_needed(), '\0');
+    auto [end, error] = arby::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    REQUIRE(error == std::errc());
+    CHECK(std::string(buffer.data(), end) == (std::string)value);
+}
+
+TEST_CASE("arby::to_chars() keeps zeroes in the middle of large values", "[charconv]") {
+    arby::Nat value = arby::ipow(36, 300) + 1;
+    std::string buffer(value.chars_needed(36), '\0');
+    auto [end, error] = arby::to_chars(buffer.data(), buffer.data() + buffer.size(), value, 36);
+    REQUIRE(error == std::errc());
+    CHECK(std::string(buffer.data(), end) == "1" + std::string(299, '0') + "1");
+}
+
+TEST_CASE("arby::to_chars() reports when the buffer is too small", "[charconv]") {
+    arby::Nat value = GENERATE(12345_nat, 1000000000000000000000000000000000000000000000_nat);
+    std::string digits = (std::string)value;
+    std::string buffer(digits.size() - 1, '\0');
+    auto [end, error] = arby::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    CHECK(error == std::errc::value_too_large);
+    CHECK(end == buffer.data() + buffer.size());
+}
+
+TEST_CASE("arby::to_chars() and arby::from_chars() in power-of-two bases agree with digits found by division", "[charconv]") {
+    std::mt19937 engine(GENERATE(8u, 9u));
+    arby::Nat value = random_nat(engine, GENERATE(1u, 3u, 33u));
+    int base = GENERATE(2, 4, 8, 16, 32);
+    // least significant first, reversed afterwards
+    std::string expected;
+    for (arby::Nat remaining = value; remaining > 0; remaining /= (uintmax_t)base) {
+        expected += "0123456789abcdefghijklmnopqrstuv"[(uintmax_t)(remaining % (uintmax_t)base)];
+    }
+    std::reverse(expected.begin(), expected.end());
+    std::string buffer(value.chars_needed(base), '\0');
+    auto [end, error] = arby::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+    REQUIRE(error == std::errc());
+    CHECK(std::string(buffer.data(), end) == expected);
+    arby::Nat result;
+    auto [read_end, read_error] = arby::from_chars(expected.data(), expected.data() + expected.size(), result, base);
+    CHECK(read_error == std::errc());
+    CHECK(read_end == expected.data() + expected.size());
+    CHECK(result == value);
+}
+
+TEST_CASE("arby::to_chars() in power-of-two bases reports when the buffer is too small", "[charconv]") {
+    int base = GENERATE(2, 8, 16);
+    arby::Nat value = arby::ipow((uintmax_t)base, 40) - 1;
+    std::string buffer(39, '\0');
+    auto [end, error] = arby::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+    CHECK(error == std::errc::value_too_large);
+    CHECK(end == buffer.data() + buffer.size());
+}
+
+TEST_CASE("arby::Nat::chars_needed() is enough but not much more than needed", "[charconv]") {
+    std::mt19937 engine(GENERATE(4u, 5u));
+    arby::Nat value = random_nat(engine, GENERATE(1u, 5u, 50u));
+    int base = GENERATE(2, 7, 10, 16, 36);
+    std::string buffer(value.chars_needed(base), '\0');
+    auto [end, error] = arby::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+    REQUIRE(error == std::errc());
+    CHECK((std::size_t)(buffer.data() + buffer.size() - end) <= 2);
+}
+
+TEST_CASE("arby::from_chars() reads the longest run of digits at the start of the buffer", "[charconv]") {
+    auto [input, base, expected, length] = GENERATE(
+        table<std::string, int, arby::Nat, std::size_t>(
+            {
+                {"0", 10, 0, 1},
+                {"12345 and the rest", 10, 12345, 5},
+                {"ffFFg", 16, 0xffff, 4},
+                {"101012", 2, 21, 5},
+                {"zz", 36, 1295, 2},
+                {"340282366920938463463374607431768211456", 10, 340282366920938463463374607431768211456_nat, 39},
+            }
+        )
+    );
+    arby::Nat value;
+    auto [end, error] = arby::from_chars(input.data(), input.data() + input.size(), value, base);
+    CHECK(error == std::errc());
+    CHECK(end == input.data() + length);
+    CHECK(value == expected);
+}
+
+TEST_CASE("arby::from_chars() leaves the value alone when there are no digits", "[charconv]") {
+    std::string input = GENERATE("", "-1", " 1", "+1", "g");
+    arby::Nat value = 7;
+    auto [end, error] = arby::from_chars(input.data(), input.data() + input.size(), value, 16);
+    CHECK(error == std::errc::invalid_argument);
+    CHECK(end == input.data());
+    CHECK(value == 7);
+}
+
+TEST_CASE("arby::from_chars() round-trips arby::to_chars()", "[charconv]") {
+    std::mt19937 engine(GENERATE(6u, 7u));
+    arby::Nat value = random_nat(engine, GENERATE(1u, 40u));
+    int base = GENERATE(3, 10, 32);
+    std::string buffer(value.chars_needed(base), '\0');
+    auto [end, error] = arby::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+    REQUIRE(error == std::errc());
+    arby::Nat result;
+    auto [read_end, read_error] = arby::from_chars(buffer.data(), end, result, base);
+    CHECK(read_error == std::errc());
+    CHECK(read_end == end);
+    CHECK(result == value);
+}
+
+TEST_CASE("arby::to_chars() and arby::from_chars() reject bases outside 2 to 36", "[charconv]") {
+    int base = GENERATE(-1, 0, 1, 37);
+    char buffer[8] = {};
+    arby::Nat value = 5;
+    CHECK_THROWS_AS(arby::to_chars(buffer, buffer + sizeof(buffer), value, base), std::invalid_argument);
+    CHECK_THROWS_AS(arby::from_chars(buffer, buffer + sizeof(buffer), value, base), std::invalid_argument);
+    CHECK_THROWS_AS(value.chars_needed(base), std::invalid_argument);
+}
@@ -0,0 +1,111 @@
+#include <cstdint>
+
+#include <limits>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+using namespace com::saxbophone;
+
+TEST_CASE("arby::factorial() gives same result as multiplying in a loop", "[math-support][combinatorics]") {
+    uintmax_t n = GENERATE(range((uintmax_t)0, (uintmax_t)40), (uintmax_t)127, (uintmax_t)128, (uintmax_t)300);
+    arby::Nat expected = 1;
+    for (uintmax_t i = 2; i <= n; i++) {
+        expected *= i;
+    }
+
+    CAPTURE(n);
+
+    CHECK(arby::factorial(n) == expected);
+}
+
+TEST_CASE("arby::factorial() of 20 is the largest to fit in 64 bits", "[math-support][combinatorics]") {
+    CHECK(arby::factorial(20) == (uintmax_t)2432902008176640000u);
+    CHECK(arby::factorial(21) > std::numeric_limits<std::uint64_t>::max());
+}
+
+TEST_CASE("arby::binomial() satisfies Pascal's rule", "[math-support][combinatorics]") {
+    uintmax_t n = GENERATE(range((uintmax_t)1, (uintmax_t)30), (uintmax_t)100, (uintmax_t)257);
+    uintmax_t k = GENERATE(take(5, random((uintmax_t)1, (uintmax_t)300)));
+
+    CAPTURE(n, k);
+
+    CHECK(arby::binomial(n, k) == arby::binomial(n - 1, k - 1) + arby::binomial(n - 1, k));
+}
+
+TEST_CASE("arby::binomial() edge cases", "[math-support][combinatorics]") {
+    uintmax_t n = GENERATE(take(10, random((uintmax_t)0, (uintmax_t)1000)));
+
+    CHECK(arby::binomial(n, 0) == 1);
+    CHECK(arby::binomial(n, n) == 1);
+    CHECK(arby::binomial(n, n + 1) == 0);
+    if (n > 0) {
+        CHECK(arby::binomial(n, 1) == n);
+        CHECK(arby::binomial(n, n - 1) == n);
+    }
+}
+
+TEST_CASE("arby::binomial() gives same result as factorials", "[math-support][combinatorics]") {
+    // 5000 is large enough for small k to be worked out by division rather than from primes
+    uintmax_t n = GENERATE((uintmax_t)50, (uintmax_t)200, (uintmax_t)5000);
+    uintmax_t k = GENERATE((uintmax_t)1, (uintmax_t)2, take(5, random((uintmax_t)0, (uintmax_t)50)));
+
+    CAPTURE(n, k);
+
+    CHECK(arby::binomial(n, k) * arby::factorial(k) * arby::factorial(n - k) == arby::factorial(n));
+}
+
+TEST_CASE("arby::binomial() of huge n and small k", "[math-support][combinatorics]") {
+    uintmax_t n = GENERATE((uintmax_t)1u << 40, (uintmax_t)1'000'000'000'000u, std::numeric_limits<uintmax_t>::max());
+
+    CAPTURE(n);
+
+    CHECK(arby::binomial(n, 0) == 1);
+    CHECK(arby::binomial(n, n) == 1);
+    CHECK(arby::binomial(n, 1) == n);
+    CHECK(arby::binomial(n, n - 1) == n);
+    CHECK(arby::binomial(n, 2) == arby::Nat(n) * (n - 1) / 2);
+    CHECK(arby::binomial(n, n - 2) == arby::Nat(n) * (n - 1) / 2);
+}
+
+TEST_CASE("arby::double_factorial() gives same result as multiplying in a loop", "[math-support][combinatorics]") {
+    uintmax_t n = GENERATE(range((uintmax_t)0, (uintmax_t)40), (uintmax_t)199, (uintmax_t)200);
+    arby::Nat expected = 1;
+    for (uintmax_t i = n; i > 1; i -= 2) {
+        expected *= i;
+    }
+
+    CAPTURE(n);
+
+    CHECK(arby::double_factorial(n) == expected);
+}
+
+TEST_CASE("arby::primorial()", "[math-support][combinatorics]") {
+    auto [n, expected] = GENERATE(
+        table<uintmax_t, uintmax_t>(
+            {
+                {0, 1}, {1, 1}, {2, 2}, {3, 6}, {4, 6}, {5, 30}, {10, 210},
+                {13, 30030}, {30, 6469693230}, {52, 614889782588491410},
+            }
+        )
+    );
+
+    CAPTURE(n);
+
+    CHECK(arby::primorial(n) == expected);
+}
+
+TEST_CASE("arby::primorial() of larger values is the product of all primes up to them", "[math-support][combinatorics]") {
+    uintmax_t n = GENERATE((uintmax_t)100, (uintmax_t)1000, (uintmax_t)1024);
+    arby::Nat expected = 1;
+    for (uintmax_t i = 2; i <= n; i++) {
+        if (arby::is_probable_prime(i)) {
+            expected *= i;
+        }
+    }
+
+    CAPTURE(n);
+
+    CHECK(arby::primorial(n) == expected);
+}
@@ -0,0 +1,61 @@
+#include <cstdint>
+
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+using namespace com::saxbophone;
+using namespace com::saxbophone::arby::literals;
+
+TEST_CASE("arby::fibonacci() gives same result as adding in a loop", "[math-support][fibonacci]") {
+    arby::Nat previous = 1; // F(-1)
+    arby::Nat current = 0;
+    for (uintmax_t n = 0; n < 300; n++) {
+        CAPTURE(n);
+        CHECK(arby::fibonacci(n) == current);
+        CHECK(arby::fib2(n) == std::pair<arby::Nat, arby::Nat>(current, previous));
+        arby::Nat next = current + previous;
+        previous = current;
+        current = next;
+    }
+}
+
+TEST_CASE("arby::lucas() gives same result as adding in a loop", "[math-support][fibonacci]") {
+    arby::Nat current = 2;
+    arby::Nat next = 1;
+    for (uintmax_t n = 0; n < 300; n++) {
+        CAPTURE(n);
+        CHECK(arby::lucas(n) == current);
+        arby::Nat after = current + next;
+        current = next;
+        next = after;
+    }
+}
+
+TEST_CASE("arby::fibonacci() and arby::lucas() of known large values", "[math-support][fibonacci]") {
+    CHECK(arby::fibonacci(100) == 354224848179261915075_nat);
+    CHECK(arby::lucas(100) == 792070839848372253127_nat);
+    CHECK(arby::fibonacci(1000).digit_length() == 22); // F(1000) is 694 bits long
+    CHECK(arby::fibonacci(1000).bit_length() == 694);
+}
+
+TEST_CASE("arby::fibonacci() and arby::lucas() satisfy doubling identities", "[math-support][fibonacci]") {
+    uintmax_t n = GENERATE(take(10, random((uintmax_t)1, (uintmax_t)2000)));
+    auto [f, f_previous] = arby::fib2(n);
+    arby::Nat l = arby::lucas(n);
+
+    CAPTURE(n);
+
+    // F(2n) = F(n)L(n)
+    CHECK(arby::fibonacci(2 * n) == f * l);
+    // F(2n - 1) = F(n)² + F(n - 1)²
+    CHECK(arby::fibonacci(2 * n - 1) == f * f + f_previous * f_previous);
+    // L(n)² = 5F(n)² + 4(-1)ⁿ
+    if (n % 2 == 0) {
+        CHECK(l * l == 5 * f * f + 4);
+    } else {
+        CHECK(l * l + 4 == 5 * f * f);
+    }
+}
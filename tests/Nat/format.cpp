@@ -0,0 +1,70 @@
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#ifdef __cpp_lib_format
+#include <cstdint>
+
+#include <limits>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+using namespace com::saxbophone;
+using namespace com::saxbophone::arby::literals;
+
+TEST_CASE("std::format() of arby::Nat agrees with std::format() of uintmax_t", "[format]") {
+    uintmax_t value = GENERATE(0u, 1u, 8u, 255u, 1234u, 123456789u, std::numeric_limits<uintmax_t>::max());
+    std::string format = GENERATE(
+        "{}", "{:d}", "{:b}", "{:B}", "{:o}", "{:x}", "{:X}", "{:#b}", "{:#B}", "{:#o}", "{:#x}", "{:#X}",
+        "{:12}", "{:<12}", "{:^12}", "{:>12}", "{:*^12}", "{:012}", "{:#012x}", "{:+}", "{: }", "{:-}", "{:+#010o}"
+    );
+    arby::Nat nat = value;
+    CHECK(std::vformat(format, std::make_format_args(nat)) == std::vformat(format, std::make_format_args(value)));
+}
+
+TEST_CASE("std::format() of large arby::Nat values", "[format]") {
+    auto [format, value, expected] = GENERATE(
+        table<std::string, arby::Nat, std::string>(
+            {
+                {"{}", 1234567890123456789012345678901234567890_nat, "1234567890123456789012345678901234567890"},
+                {"{:#x}", 0x123456789abcdef0123456789abcdef_nat, "0x123456789abcdef0123456789abcdef"},
+                {"{:X}", 0x123456789abcdef0123456789abcdef_nat, "123456789ABCDEF0123456789ABCDEF"},
+                {"{:>45}", 1234567890123456789012345678901234567890_nat, "     1234567890123456789012345678901234567890"},
+                {"{:b}", arby::Nat(1) << 70, "1" + std::string(70, '0')},
+            }
+        )
+    );
+    CHECK(std::vformat(format, std::make_format_args(value)) == expected);
+}
+
+TEST_CASE("std::format() of arby::Nat with digit grouping", "[format]") {
+    auto [format, value, expected] = GENERATE(
+        table<std::string, arby::Nat, std::string>(
+            {
+                {"{:,}", 0, "0"},
+                {"{:,}", 123, "123"},
+                {"{:,}", 1234, "1,234"},
+                {"{:_}", 1234567890123_nat, "1_234_567_890_123"},
+                {"{:_x}", 0xdeadbeefcafe_nat, "dead_beef_cafe"},
+                {"{:#_b}", 0b1011001_nat, "0b101_1001"},
+                {"{:>8,}", 1234, "   1,234"},
+            }
+        )
+    );
+    CHECK(std::vformat(format, std::make_format_args(value)) == expected);
+}
+
+TEST_CASE("std::format() of arby::Nat with a multi-byte fill character", "[format]") {
+    CHECK(std::format("{:→>6}", arby::Nat(42)) == "→→→→42");
+}
+
+TEST_CASE("std::format() of arby::Nat rejects invalid format specifications", "[format]") {
+    std::string format = GENERATE("{:.3}", "{:q}", "{:s}", "{:{}}", "{:L}");
+    arby::Nat value = 1;
+    int width = 5;
+    CHECK_THROWS_AS(std::vformat(format, std::make_format_args(value, width)), std::format_error);
+}
+#endif
@@ -0,0 +1,124 @@
+#include <cstdint>
+
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+
+TEST_CASE("arby::gcd() with zero", "[math-support][gcd]") {
+    uintmax_t value = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+
+    CHECK(arby::gcd(value, 0) == value);
+    CHECK(arby::gcd(0, value) == value);
+}
+
+TEST_CASE("arby::gcd() gives same result as std::gcd() for values that fit in uintmax_t", "[math-support][gcd]") {
+    uintmax_t a = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t b = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    // plenty of common factors too
+    uintmax_t factor = GENERATE((uintmax_t)1, (uintmax_t)6, (uintmax_t)1024);
+
+    CHECK(arby::gcd(a / factor * factor, b / factor * factor) == std::gcd(a / factor * factor, b / factor * factor));
+}
+
+TEST_CASE("arby::gcd() of multi-digit values with a known common factor", "[math-support][gcd]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t digits = GENERATE((std::size_t)2, (std::size_t)5, (std::size_t)12);
+    arby::Nat factor = random_nat(engine, digits);
+    arby::Nat a = random_nat(engine, digits);
+    // consecutive values are always coprime
+    arby::Nat b = a + 1;
+
+    CAPTURE(factor, a, b);
+
+    CHECK(arby::gcd(a * factor, b * factor) == factor);
+    CHECK(arby::gcd(b * factor, a * factor) == factor);
+    CHECK(arby::gcd(a * factor, factor) == factor);
+}
+
+TEST_CASE("arby::gcd() of consecutive Fibonacci numbers is one", "[math-support][gcd]") {
+    // the worst case for Euclid's algorithm, as every quotient is one
+    arby::Nat a = 0, b = 1;
+    for (int i = 0; i < 500; i++) {
+        arby::Nat c = a + b;
+        a = b;
+        b = c;
+    }
+
+    CHECK(arby::gcd(a, b) == 1);
+    CHECK(arby::gcdext(b, a).gcd == 1);
+}
+
+TEST_CASE("arby::gcdext() with zero a throws std::domain_error", "[math-support][gcdext]") {
+    CHECK_THROWS_AS(arby::gcdext(0, 3), std::domain_error);
+}
+
+TEST_CASE("arby::gcdext() with zero b", "[math-support][gcdext]") {
+    uintmax_t value = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+
+    CHECK(arby::gcdext(value, 0) == arby::GcdResult<arby::Nat>(value, 1, 0));
+}
+
+TEST_CASE("arby::gcdext() gives coefficients satisfying Bézout's identity", "[math-support][gcdext]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t a_digits = GENERATE((std::size_t)1, (std::size_t)3, (std::size_t)8);
+    std::size_t b_digits = GENERATE((std::size_t)1, (std::size_t)3, (std::size_t)8);
+    arby::Nat factor = random_nat(engine, 1);
+    arby::Nat a = random_nat(engine, a_digits) * factor;
+    arby::Nat b = random_nat(engine, b_digits) * factor;
+
+    CAPTURE(a, b);
+
+    auto [g, x, y] = arby::gcdext(a, b);
+
+    CHECK(g == arby::gcd(a, b));
+    CHECK(a * x - b * y == g);
+    CHECK(x <= b / g);
+    CHECK(y <= a / g);
+}
+
+TEST_CASE("arby::lcm()", "[math-support][lcm]") {
+    uintmax_t a = GENERATE(take(10, random((uintmax_t)0, (uintmax_t)std::numeric_limits<std::uint32_t>::max())));
+    uintmax_t b = GENERATE(take(10, random((uintmax_t)0, (uintmax_t)std::numeric_limits<std::uint32_t>::max())));
+
+    CHECK(arby::lcm(a, b) == std::lcm(a, b));
+}
+
+TEST_CASE("arby::invmod() with zero modulus throws std::domain_error", "[math-support][invmod]") {
+    CHECK_THROWS_AS(arby::invmod(3, 0), std::domain_error);
+}
+
+TEST_CASE("arby::invmod() of value sharing a factor with modulus throws std::domain_error", "[math-support][invmod]") {
+    uintmax_t a = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max() / 6)));
+    uintmax_t m = GENERATE(take(10, random((uintmax_t)1, std::numeric_limits<uintmax_t>::max() / 6)));
+
+    CHECK_THROWS_AS(arby::invmod(a * 6, m * 3), std::domain_error);
+}
+
+TEST_CASE("arby::invmod() gives the modular inverse", "[math-support][invmod]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t digits = GENERATE((std::size_t)1, (std::size_t)4, (std::size_t)10);
+    arby::Nat modulus = random_nat(engine, digits);
+    arby::Nat a = random_nat(engine, digits + 1);
+    // make them coprime
+    a /= arby::gcd(a, modulus);
+    while (arby::gcd(a, modulus) != 1) {
+        a += 1;
+    }
+
+    CAPTURE(a, modulus);
+
+    arby::Nat inverse = arby::invmod(a, modulus);
+
+    CHECK(inverse < modulus);
+    CHECK(a * inverse % modulus == 1);
+}
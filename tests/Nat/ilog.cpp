@@ -3,6 +3,7 @@
 
 #include <limits>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 #include <catch2/catch.hpp>
@@ -94,3 +95,60 @@ TEST_CASE("arby::ilog(2**i, x) regression test", "[math-support][ilog]") {
 
     CHECK(result == expected);
 }
+
+TEST_CASE("arby::ilog() of exact powers of large values", "[math-support][ilog]") {
+    uintmax_t base = GENERATE(take(10, random((uintmax_t)3, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t exponent = GENERATE(take(5, random((uintmax_t)1, (uintmax_t)50)));
+    arby::Nat power = arby::ipow(base, exponent);
+
+    CAPTURE(base, exponent);
+
+    // exact power of base
+    CHECK(arby::ilog(base, power) == arby::Interval<uintmax_t>(exponent));
+    // one either side of it
+    CHECK(arby::ilog(base, power - 1) == arby::Interval<uintmax_t>(exponent - 1, exponent));
+    CHECK(arby::ilog(base, power + 1) == arby::Interval<uintmax_t>(exponent, exponent + 1));
+}
+
+TEST_CASE("arby::ilog10() of powers of 10 and their neighbours", "[math-support][ilog]") {
+    uintmax_t exponent = GENERATE(range((uintmax_t)1, (uintmax_t)200));
+    arby::Nat power = arby::ipow(10, exponent);
+
+    CHECK(arby::ilog10(power) == arby::Interval<uintmax_t>(exponent));
+    CHECK(arby::ilog10(power - 1) == arby::Interval<uintmax_t>(exponent - 1, exponent));
+    CHECK(arby::ilog10(power + 1) == arby::Interval<uintmax_t>(exponent, exponent + 1));
+}
+
+TEST_CASE("arby::digit_count() matches length of string representation", "[math-support][ilog]") {
+    uintmax_t value = GENERATE(take(1000, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+
+    CHECK(arby::digit_count(value) == std::to_string(value).size());
+}
+
+TEST_CASE("arby::digit_count() with hardcoded values", "[math-support][ilog]") {
+    auto [x, base, expected] = GENERATE(
+        table<uintmax_t, uintmax_t, uintmax_t>(
+            {
+                {0, 10, 1},
+                {0, 2, 1},
+                {1, 10, 1},
+                {9, 10, 1},
+                {10, 10, 2},
+                {255, 16, 2},
+                {256, 16, 3},
+                {255, 2, 8},
+                {256, 2, 9},
+                {80, 3, 4},
+                {81, 3, 5},
+            }
+        )
+    );
+
+    CHECK(arby::digit_count(x, base) == expected);
+}
+
+TEST_CASE("arby::digit_count() with base < 2 throws std::domain_error", "[math-support][ilog]") {
+    uintmax_t base = GENERATE((uintmax_t)0, (uintmax_t)1);
+
+    CHECK_THROWS_AS(arby::digit_count(1234, base), std::domain_error);
+}
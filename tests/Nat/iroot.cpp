@@ -56,3 +56,32 @@ TEST_CASE("arby::Nat Integer root of arbitrary base and exponents gives floor an
 
     CHECK(root == expected);
 }
+
+TEST_CASE("arby::Nat Integer root of large values gives floor and ceil of Real answer", "[math-support][iroot]") {
+    uintmax_t base = GENERATE(take(5, random((uintmax_t)2, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t offset = GENERATE(take(2, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t exponent = GENERATE((uintmax_t)2, (uintmax_t)3, (uintmax_t)5, (uintmax_t)17);
+    // big enough that the root is too wide to be estimated from floating-point alone
+    arby::Nat x = arby::ipow(base, 24) + offset;
+
+    auto [floor, ceil] = arby::iroot(exponent, x);
+
+    CAPTURE(base, offset, exponent, floor, ceil);
+
+    CHECK(arby::ipow(floor, exponent) <= x);
+    CHECK(arby::ipow(ceil, exponent) >= x);
+    CHECK(ceil - floor <= 1);
+    if (floor == ceil) {
+        CHECK(arby::ipow(floor, exponent) == x);
+    }
+}
+
+TEST_CASE("arby::Nat Integer root of large perfect powers is exact", "[math-support][iroot]") {
+    uintmax_t base = GENERATE(take(10, random((uintmax_t)2, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t exponent = GENERATE((uintmax_t)2, (uintmax_t)3, (uintmax_t)7);
+    // root is several digits wide
+    arby::Nat root = arby::ipow(base, 3) + 1;
+    auto perfect_power = arby::ipow(root, exponent);
+
+    CHECK(arby::iroot(exponent, perfect_power) == arby::Interval<arby::Nat>(root));
+}
@@ -0,0 +1,84 @@
+#include <cmath>
+#include <cstdint>
+
+#include <limits>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+#include <arby/SqrtResult.hpp>
+
+using namespace com::saxbophone;
+
+TEST_CASE("arby::isqrtrem() of values that fit in uintmax_t", "[math-support][isqrt]") {
+    uintmax_t x = GENERATE(take(1000, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+
+    auto [root, remainder] = arby::isqrtrem(x);
+
+    CAPTURE(x, root, remainder);
+
+    CHECK(root * root + remainder == x);
+    CHECK(remainder <= root * 2); // otherwise, root + 1 would also fit
+}
+
+TEST_CASE("arby::isqrtrem() with hardcoded values", "[math-support][isqrt]") {
+    auto [x, expected_root, expected_remainder] = GENERATE(
+        table<uintmax_t, uintmax_t, uintmax_t>(
+            {
+                {0, 0, 0},
+                {1, 1, 0},
+                {2, 1, 1},
+                {3, 1, 2},
+                {4, 2, 0},
+                {99, 9, 18},
+                {100, 10, 0},
+                {std::numeric_limits<uintmax_t>::max(), std::numeric_limits<std::uint32_t>::max(), 2ull * std::numeric_limits<std::uint32_t>::max()},
+            }
+        )
+    );
+
+    CHECK(arby::isqrtrem(x) == arby::SqrtResult<arby::Nat>(expected_root, expected_remainder));
+}
+
+TEST_CASE("arby::isqrtrem() of large values", "[math-support][isqrt]") {
+    uintmax_t base = GENERATE(take(20, random((uintmax_t)2, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t offset = GENERATE(take(5, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t power = GENERATE((uintmax_t)2, (uintmax_t)3, (uintmax_t)5, (uintmax_t)16);
+    arby::Nat x = arby::ipow(base, power) + offset;
+
+    auto [root, remainder] = arby::isqrtrem(x);
+
+    CAPTURE(base, offset, power, root, remainder);
+
+    CHECK(root * root + remainder == x);
+    CHECK(remainder <= root * 2);
+}
+
+TEST_CASE("arby::isqrt() agrees with arby::iroot()", "[math-support][isqrt]") {
+    uintmax_t base = GENERATE(take(10, random((uintmax_t)2, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t offset = GENERATE(take(5, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    arby::Nat x = arby::ipow(base, 7) + offset;
+
+    CHECK(arby::isqrt(x) == arby::iroot(2, x).floor);
+}
+
+TEST_CASE("arby::is_perfect_square() of perfect squares", "[math-support][isqrt]") {
+    uintmax_t base = GENERATE(take(100, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t power = GENERATE((uintmax_t)1, (uintmax_t)2, (uintmax_t)5);
+    arby::Nat root = arby::ipow(base, power);
+
+    CHECK(arby::is_perfect_square(root * root));
+}
+
+TEST_CASE("arby::is_perfect_square() of non-squares", "[math-support][isqrt]") {
+    uintmax_t base = GENERATE(take(100, random((uintmax_t)1, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t power = GENERATE((uintmax_t)1, (uintmax_t)2, (uintmax_t)5);
+    arby::Nat root = arby::ipow(base, power);
+    arby::Nat square = root * root;
+
+    // squares either side of this one are at least 2·root + 1 apart
+    CHECK_FALSE(arby::is_perfect_square(square + 1));
+    CHECK_FALSE(arby::is_perfect_square(square + root));
+    CHECK_FALSE(arby::is_perfect_square(square + root * 2));
+    CHECK_FALSE(arby::is_perfect_square(square - 1));
+}
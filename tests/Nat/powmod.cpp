@@ -0,0 +1,81 @@
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+
+TEST_CASE("arby::powmod() with zero modulus throws std::domain_error", "[math-support][powmod]") {
+    CHECK_THROWS_AS(arby::powmod(3, 4, 0), std::domain_error);
+}
+
+TEST_CASE("arby::powmod() with modulus of 1 is always zero", "[math-support][powmod]") {
+    uintmax_t base = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t exponent = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+
+    CHECK(arby::powmod(base, exponent, 1) == 0);
+}
+
+TEST_CASE("arby::powmod() with zero exponent is always one", "[math-support][powmod]") {
+    uintmax_t base = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t modulus = GENERATE(take(10, random((uintmax_t)2, std::numeric_limits<uintmax_t>::max())));
+
+    CHECK(arby::powmod(base, 0, modulus) == 1);
+}
+
+TEST_CASE("arby::powmod() gives same result as arby::ipow() then modulo", "[math-support][powmod]") {
+    uintmax_t base = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    uintmax_t exponent = GENERATE(take(5, random((uintmax_t)0, (uintmax_t)30)));
+    // covers both odd and even moduli
+    uintmax_t modulus = GENERATE(take(10, random((uintmax_t)2, std::numeric_limits<uintmax_t>::max())));
+
+    CAPTURE(base, exponent, modulus);
+
+    CHECK(arby::powmod(base, exponent, modulus) == arby::ipow(base, exponent) % modulus);
+}
+
+TEST_CASE("arby::powmod() with multi-digit modulus gives same result as arby::ipow() then modulo", "[math-support][powmod]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t digits = GENERATE((std::size_t)2, (std::size_t)4);
+    arby::Nat base = random_nat(engine, digits + 1);
+    arby::Nat modulus = random_nat(engine, digits);
+    uintmax_t exponent = GENERATE((uintmax_t)1, (uintmax_t)2, (uintmax_t)7, (uintmax_t)17);
+
+    CAPTURE(base, exponent, modulus);
+
+    CHECK(arby::powmod(base, exponent, modulus) == arby::ipow(base, exponent) % modulus);
+    // and again with the other parity of modulus
+    CHECK(arby::powmod(base, exponent, modulus + 1) == arby::ipow(base, exponent) % (modulus + 1));
+}
+
+TEST_CASE("arby::powmod() obeys Fermat's little theorem for Mersenne primes", "[math-support][powmod]") {
+    uintmax_t exponent = GENERATE((uintmax_t)61, (uintmax_t)89, (uintmax_t)127, (uintmax_t)521);
+    arby::Nat prime = arby::ipow(2, exponent) - 1;
+    uintmax_t base = GENERATE(take(5, random((uintmax_t)2, std::numeric_limits<uintmax_t>::max())));
+
+    CHECK(arby::powmod(base, prime - 1, prime) == 1);
+    CHECK(arby::powmod(base, prime, prime) == base % prime);
+}
+
+TEST_CASE("arby::powmod() throughput at standard key sizes", "[.][benchmark][powmod]") {
+    std::mt19937 engine(12345);
+    std::size_t bits = GENERATE((std::size_t)2048, (std::size_t)3072, (std::size_t)4096, (std::size_t)8192);
+    std::size_t digits = bits / std::numeric_limits<arby::Nat::StorageType>::digits;
+    arby::Nat base = random_nat(engine, digits);
+    arby::Nat exponent = random_nat(engine, digits);
+    arby::Nat modulus = random_nat(engine, digits) | 1; // RSA moduli are always odd
+
+    BENCHMARK("powmod " + std::to_string(bits) + "-bit") {
+        return arby::powmod(base, exponent, modulus);
+    };
+}
@@ -0,0 +1,140 @@
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+using namespace com::saxbophone;
+
+// trial division by every value up to the square root, only practical for small values
+static bool is_prime_by_trial_division(uintmax_t n) {
+    if (n < 2) { return false; }
+    for (uintmax_t divisor = 2; divisor * divisor <= n; divisor++) {
+        if (n % divisor == 0) { return false; }
+    }
+    return true;
+}
+
+// builds a random arby::Nat of exactly the given number of bits
+static arby::Nat random_nat_bits(std::mt19937& engine, std::size_t bits) {
+    std::size_t digits = bits / std::numeric_limits<arby::Nat::StorageType>::digits;
+    std::vector<arby::Nat::StorageType> value(digits);
+    for (auto& digit : value) {
+        digit = (arby::Nat::StorageType)engine();
+    }
+    value.front() |= (arby::Nat::StorageType)1 << (std::numeric_limits<arby::Nat::StorageType>::digits - 1);
+    return value;
+}
+
+TEST_CASE("arby::is_probable_prime() agrees with trial division", "[math-support][primality]") {
+    // spans the lookup table, trial division and Baillie-PSW ranges
+    uintmax_t start = GENERATE((uintmax_t)0, (uintmax_t)1000, (uintmax_t)1048000, (uintmax_t)4294960000);
+    for (uintmax_t n = start; n < start + 2000; n++) {
+        CAPTURE(n);
+        CHECK(arby::is_probable_prime(n) == is_prime_by_trial_division(n));
+    }
+}
+
+TEST_CASE("arby::is_probable_prime() rejects pseudoprimes", "[math-support][primality]") {
+    // strong pseudoprimes to several bases, Lucas pseudoprimes and Carmichael numbers
+    uintmax_t n = GENERATE(
+        (uintmax_t)2047, (uintmax_t)1373653, (uintmax_t)25326001, (uintmax_t)3215031751,
+        (uintmax_t)2152302898747, (uintmax_t)3474749660383, (uintmax_t)341550071728321,
+        (uintmax_t)3825123056546413051, (uintmax_t)5459, (uintmax_t)5777, (uintmax_t)10877,
+        (uintmax_t)561, (uintmax_t)41041, (uintmax_t)825265, (uintmax_t)321197185
+    );
+
+    CHECK_FALSE(arby::is_probable_prime(n));
+    CHECK_FALSE(arby::is_probable_prime(n, 10));
+}
+
+TEST_CASE("arby::is_probable_prime() with Mersenne numbers", "[math-support][primality]") {
+    auto [exponent, is_prime] = GENERATE(
+        table<uintmax_t, bool>(
+            {
+                {61, true}, {67, false}, {89, true}, {107, true}, {127, true},
+                {257, false}, {521, true}, {523, false}, {607, true}, {1279, true},
+            }
+        )
+    );
+    arby::Nat n = arby::ipow(2, exponent) - 1;
+
+    CAPTURE(exponent);
+
+    CHECK(arby::is_probable_prime(n) == is_prime);
+    CHECK(arby::is_probable_prime(n, 3) == is_prime);
+}
+
+TEST_CASE("arby::is_probable_prime() with products of two large primes", "[math-support][primality]") {
+    // both factors are prime, so neither trial division nor a perfect-square check can catch these
+    arby::Nat p = arby::ipow(2, 89) - 1;
+    arby::Nat q = arby::ipow(2, 107) - 1;
+
+    CHECK_FALSE(arby::is_probable_prime(p * q));
+    CHECK_FALSE(arby::is_probable_prime(p * p));
+}
+
+TEST_CASE("arby::next_prime() agrees with trial division", "[math-support][primality]") {
+    uintmax_t start = GENERATE((uintmax_t)0, (uintmax_t)1000, (uintmax_t)1048000, (uintmax_t)4294960000);
+    for (uintmax_t n = start; n < start + 500; n++) {
+        uintmax_t expected = n + 1;
+        while (not is_prime_by_trial_division(expected)) {
+            expected++;
+        }
+
+        CAPTURE(n);
+        CHECK(arby::next_prime(n) == expected);
+    }
+}
+
+TEST_CASE("arby::next_prime() of 2 to the power of some exponent", "[math-support][primality]") {
+    // offsets from OEIS A013603, the smallest k such that 2ⁿ + k is prime
+    auto [exponent, offset] = GENERATE(
+        table<uintmax_t, uintmax_t>(
+            {
+                {64, 13}, {100, 277}, {128, 51}, {256, 297}, {512, 75},
+            }
+        )
+    );
+
+    CAPTURE(exponent);
+
+    CHECK(arby::next_prime(arby::ipow(2, exponent)) == arby::ipow(2, exponent) + offset);
+}
+
+TEST_CASE("arby::is_probable_prime() throughput", "[.][benchmark][primality]") {
+    std::mt19937 engine(12345);
+    // Mersenne primes of about the same size, as searching for random primes this big takes too long
+    auto [bits, mersenne_exponent] = GENERATE(
+        table<std::size_t, uintmax_t>(
+            {
+                {512, 521}, {1024, 1279}, {2048, 2203}, {4096, 4253},
+            }
+        )
+    );
+    // odd candidates with no factors below 1024, i.e. those which make it to the Baillie-PSW test
+    arby::Nat small_primes = 1;
+    for (uintmax_t p = 3; p < 1024; p++) {
+        if (is_prime_by_trial_division(p)) {
+            small_primes *= p;
+        }
+    }
+    arby::Nat candidate = random_nat_bits(engine, bits) | 1;
+    while (arby::gcd(candidate, small_primes) != 1) {
+        candidate += 2;
+    }
+    arby::Nat prime = arby::ipow(2, mersenne_exponent) - 1;
+
+    BENCHMARK("is_probable_prime() composite " + std::to_string(bits) + "-bit") {
+        return arby::is_probable_prime(candidate);
+    };
+    BENCHMARK("is_probable_prime() prime " + std::to_string(bits) + "-bit") {
+        return arby::is_probable_prime(prime);
+    };
+}
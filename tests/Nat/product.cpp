@@ -0,0 +1,95 @@
+#include <cstdint>
+
+#include <limits>
+#include <list>
+#include <random>
+#include <vector>
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+
+// the product as found by multiplying one value after the other
+static arby::Nat naive_product(const std::vector<arby::Nat>& values) {
+    arby::Nat result = 1;
+    for (const auto& value : values) {
+        result *= value;
+    }
+    return result;
+}
+
+TEST_CASE("arby::product() of an empty range is one", "[math-support][product]") {
+    std::vector<arby::Nat> values;
+
+    CHECK(arby::product(values.begin(), values.end()) == 1);
+}
+
+TEST_CASE("arby::product() of a single value is that value", "[math-support][product]") {
+    uintmax_t value = GENERATE(take(10, random((uintmax_t)0, std::numeric_limits<uintmax_t>::max())));
+    std::vector<arby::Nat> values = {value};
+
+    CHECK(arby::product(values.begin(), values.end()) == value);
+}
+
+TEST_CASE("arby::product() of small values", "[math-support][product]") {
+    std::vector<uintmax_t> values = {2, 3, 5, 7, 11, 13};
+
+    CHECK(arby::product(values.begin(), values.end()) == 30030);
+}
+
+TEST_CASE("arby::product() of a range containing zero is zero", "[math-support][product]") {
+    std::vector<arby::Nat> values = {arby::Nat(1) << 200, 0, arby::Nat(3) << 100};
+
+    CHECK(arby::product(values.begin(), values.end()) == 0);
+}
+
+TEST_CASE("arby::product() of random values", "[math-support][product]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::uniform_int_distribution<std::size_t> sizes(1, 8);
+    std::size_t count = GENERATE(2u, 3u, 17u, 64u);
+    std::vector<arby::Nat> values;
+    for (std::size_t i = 0; i < count; i++) {
+        values.push_back(random_nat(engine, sizes(engine)));
+    }
+
+    CHECK(arby::product(values.begin(), values.end()) == naive_product(values));
+}
+
+TEST_CASE("arby::product() with multiple threads", "[math-support][product]") {
+    std::mt19937 engine(GENERATE(take(3, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t threads = GENERATE(0u, 2u, 3u, 8u);
+    std::vector<arby::Nat> values;
+    for (std::size_t i = 0; i < 50; i++) {
+        values.push_back(random_nat(engine, 4));
+    }
+
+    CHECK(arby::product(values.begin(), values.end(), threads) == naive_product(values));
+}
+
+TEST_CASE("arby::product() accepts input iterators of other containers", "[math-support][product]") {
+    std::list<arby::Nat> values = {4, 5, arby::Nat(1) << 100};
+
+    CHECK(arby::product(values.begin(), values.end()) == arby::Nat(20) << 100);
+}
+
+TEST_CASE("Benchmark arby::product() against repeated multiplication", "[.][benchmark]") {
+    std::vector<arby::Nat> values;
+    for (uintmax_t i = 1; i <= 3000; i++) {
+        values.push_back(i);
+    }
+
+    BENCHMARK("arby::product()") {
+        return arby::product(values.begin(), values.end());
+    };
+    BENCHMARK("arby::product() with all threads") {
+        return arby::product(values.begin(), values.end(), 0);
+    };
+    BENCHMARK("repeated multiplication") {
+        return naive_product(values);
+    };
+}
@@ -0,0 +1,84 @@
+#include <cstdint>
+
+#include <array>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+using namespace com::saxbophone;
+
+TEST_CASE("arby::random_bits() with zero bits is zero", "[math-support][random]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+
+    CHECK(arby::random_bits(engine, 0) == 0);
+}
+
+TEST_CASE("arby::random_bits() gives values of no more than the requested bits", "[math-support][random]") {
+    std::mt19937 engine(GENERATE(take(5, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::size_t bits = GENERATE((std::size_t)1, (std::size_t)7, (std::size_t)32, (std::size_t)33, (std::size_t)100, (std::size_t)256);
+    std::size_t longest = 0;
+    for (int i = 0; i < 50; i++) {
+        arby::Nat value = arby::random_bits(engine, bits);
+        CHECK(value.bit_length() <= bits);
+        if (value.bit_length() > longest) {
+            longest = value.bit_length();
+        }
+    }
+
+    CAPTURE(bits);
+
+    // half of all values have the top bit set, so missing it 50 times in a row is vanishingly unlikely
+    CHECK(longest == bits);
+}
+
+TEST_CASE("arby::random_bits() is reproducible from the same seed", "[math-support][random]") {
+    unsigned seed = GENERATE(take(5, random(0u, std::numeric_limits<unsigned>::max())));
+    std::mt19937 first(seed);
+    std::mt19937 second(seed);
+
+    CHECK(arby::random_bits(first, 1000) == arby::random_bits(second, 1000));
+}
+
+TEST_CASE("arby::random_below() with zero bound throws std::domain_error", "[math-support][random]") {
+    std::mt19937 engine;
+
+    CHECK_THROWS_AS(arby::random_below(engine, 0), std::domain_error);
+}
+
+TEST_CASE("arby::random_below() with bound of one is always zero", "[math-support][random]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+
+    CHECK(arby::random_below(engine, 1) == 0);
+}
+
+TEST_CASE("arby::random_below() gives values less than the bound", "[math-support][random]") {
+    std::mt19937 engine(GENERATE(take(5, random(0u, std::numeric_limits<unsigned>::max()))));
+    uintmax_t top = GENERATE(take(5, random((uintmax_t)1, std::numeric_limits<uintmax_t>::max())));
+    std::size_t shift = GENERATE((std::size_t)0, (std::size_t)17, (std::size_t)200);
+    arby::Nat bound = arby::Nat(top) << shift;
+    for (int i = 0; i < 20; i++) {
+        CHECK(arby::random_below(engine, bound) < bound);
+    }
+}
+
+TEST_CASE("arby::random_below() is uniform across the bound's leading digit", "[math-support][random]") {
+    std::mt19937 engine(GENERATE(take(3, random(0u, std::numeric_limits<unsigned>::max()))));
+    // 3.5 × 2³², so the leading digit is 0, 1 or 2 with probability 2/7 each and 3 with probability 1/7
+    arby::Nat bound = (arby::Nat(7) << 31);
+    std::array<int, 4> counts = {};
+    const int samples = 7000;
+    for (int i = 0; i < samples; i++) {
+        arby::Nat value = arby::random_below(engine, bound);
+        counts[(std::size_t)(uintmax_t)(value >> 32)]++;
+    }
+
+    // each expected count is at least 1000, so these tolerances are over six standard deviations
+    CHECK(counts[0] == Approx(2000).margin(250));
+    CHECK(counts[1] == Approx(2000).margin(250));
+    CHECK(counts[2] == Approx(2000).margin(250));
+    CHECK(counts[3] == Approx(1000).margin(200));
+}
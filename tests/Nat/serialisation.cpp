@@ -0,0 +1,104 @@
+#include <cstddef>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+using namespace com::saxbophone::arby::literals;
+
+// a file in the temporary directory, which is removed again afterwards
+struct TemporaryFile {
+    // each test case uses a different name, as ctest may run them in parallel
+    TemporaryFile(const std::string& name) : path(std::filesystem::temp_directory_path() / ("arby-" + name + ".nat")) {}
+    ~TemporaryFile() { std::filesystem::remove(path); }
+
+    void write(const std::string& contents) const {
+        std::ofstream(path, std::ios::binary) << contents;
+    }
+
+    std::filesystem::path path;
+};
+
+TEST_CASE("arby::Nat::load() reads back the value written by arby::Nat::save()", "[serialisation]") {
+    std::mt19937 engine(GENERATE(1u, 2u));
+    arby::Nat value = random_nat(engine, GENERATE(1u, 2u, 100u, 10000u)) >> GENERATE(0u, 12u);
+    TemporaryFile file("round-trip");
+    value.save(file.path);
+
+    CHECK(arby::Nat::load(file.path) == value);
+}
+
+TEST_CASE("arby::Nat::save() of zero", "[serialisation]") {
+    TemporaryFile file("zero");
+    arby::Nat(0).save(file.path);
+
+    CHECK(arby::Nat::load(file.path) == 0);
+}
+
+TEST_CASE("arby::Nat::load() reads files with other digit sizes and byte orders", "[serialisation]") {
+    auto [body, expected] = GENERATE(
+        table<std::string, arby::Nat>(
+            {
+                // three big-endian digits of two bytes each
+                {std::string("arby:Nat\x01\x02\x01\0\0\0\0\0\x03\0\0\0\0\0\0\0", 24) + "\x01\x02\x03\x04\x05\x06", 0x010203040506_nat},
+                // two little-endian digits of three bytes each
+                {std::string("arby:Nat\x01\x03\x00\0\0\0\0\0\x02\0\0\0\0\0\0\0", 24) + "\x01\x02\x03\x04\x05\x06", 0x060504030201_nat},
+                // no digits at all
+                {std::string("arby:Nat\x01\x04\x00\0\0\0\0\0\0\0\0\0\0\0\0\0", 24), 0},
+            }
+        )
+    );
+    TemporaryFile file("other-layouts");
+    file.write(body);
+
+    CHECK(arby::Nat::load(file.path) == expected);
+}
+
+TEST_CASE("arby::Nat::load() rejects invalid files", "[serialisation]") {
+    std::string body = GENERATE(
+        std::string(""),
+        std::string("not a Nat file at all, but long enough"),
+        // unknown version
+        std::string("arby:Nat\x02\x04\x00\0\0\0\0\0\x01\0\0\0\0\0\0\0\x01\0\0\0", 28),
+        // zero digit size
+        std::string("arby:Nat\x01\x00\x00\0\0\0\0\0\x01\0\0\0\0\0\0\0\x01\0\0\0", 28),
+        // unknown byte order
+        std::string("arby:Nat\x01\x04\x02\0\0\0\0\0\x01\0\0\0\0\0\0\0\x01\0\0\0", 28),
+        // reserved bytes not zero
+        std::string("arby:Nat\x01\x04\x00\0\0\0\0\x01\x01\0\0\0\0\0\0\0\x01\0\0\0", 28),
+        // truncated
+        std::string("arby:Nat\x01\x04\x00\0\0\0\0\0\x02\0\0\0\0\0\0\0\x01\0\0\0", 28)
+    );
+    TemporaryFile file("invalid");
+    file.write(body);
+
+    CHECK_THROWS_AS(arby::Nat::load(file.path), std::runtime_error);
+}
+
+TEST_CASE("arby::Nat::save() leaves the existing file alone when it fails", "[serialisation]") {
+    TemporaryFile file("failed-save");
+    arby::Nat(42).save(file.path);
+    // a directory in the way of the temporary file makes it impossible to write
+    std::filesystem::path temporary = file.path;
+    temporary += ".tmp";
+    std::filesystem::create_directory(temporary);
+
+    CHECK_THROWS_AS(arby::Nat(1234).save(file.path), std::runtime_error);
+    std::filesystem::remove(temporary);
+    CHECK(arby::Nat::load(file.path) == 42);
+}
+
+TEST_CASE("arby::Nat::load() throws std::runtime_error for a missing file", "[serialisation]") {
+    CHECK_THROWS_AS(arby::Nat::load(std::filesystem::temp_directory_path() / "arby-no-such-file.nat"), std::runtime_error);
+}
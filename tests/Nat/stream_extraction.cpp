@@ -0,0 +1,100 @@
+#include <ios>
+#include <sstream>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+using namespace com::saxbophone;
+using namespace com::saxbophone::arby::literals;
+
+TEST_CASE("Using std::istream >> arby::Nat reads decimal by default", "[stream-extraction]") {
+    auto [input, expected, rest] = GENERATE(
+        table<std::string, arby::Nat, std::string>(
+            {
+                {"0", 0, ""},
+                {"12345", 12345, ""},
+                {"   \n\t42 and more", 42, " and more"},
+                {"123abc", 123, "abc"},
+                {"00000000000000000000000000000007", 7, ""},
+                {"340282366920938463463374607431768211456,", 340282366920938463463374607431768211456_nat, ","},
+            }
+        )
+    );
+    std::istringstream stream(input);
+    arby::Nat value;
+
+    CHECK(stream >> value);
+    CHECK(value == expected);
+    std::string remaining;
+    std::getline(stream, remaining);
+    CHECK(remaining == rest);
+}
+
+TEST_CASE("Using std::istream >> arby::Nat honours std::hex and std::oct", "[stream-extraction]") {
+    auto [input, flag, expected] = GENERATE(
+        table<std::string, std::ios_base::fmtflags, arby::Nat>(
+            {
+                {"ff", std::ios_base::hex, 0xff},
+                {"DeadBeefCafeBabe1234", std::ios_base::hex, 0xdeadbeefcafebabe1234_nat},
+                {"0x1f", std::ios_base::hex, 0x1f},
+                {"0", std::ios_base::hex, 0},
+                {"777", std::ios_base::oct, 0777},
+                {"789", std::ios_base::oct, 07},
+                {"0x1f", std::ios_base::dec, 0},
+            }
+        )
+    );
+    std::istringstream stream(input);
+    stream.setf(flag, std::ios_base::basefield);
+    arby::Nat value;
+
+    CHECK(stream >> value);
+    CHECK(value == expected);
+}
+
+TEST_CASE("Using std::istream >> arby::Nat reads successive values", "[stream-extraction]") {
+    std::istringstream stream("1 22 333");
+    arby::Nat a, b, c;
+
+    CHECK(stream >> a >> b >> c);
+    CHECK(a == 1);
+    CHECK(b == 22);
+    CHECK(c == 333);
+    CHECK(stream.eof());
+}
+
+TEST_CASE("Using std::istream >> arby::Nat reads values longer than its buffer", "[stream-extraction]") {
+    std::string digits = "9" + std::string(10000, '0');
+    std::istringstream stream(digits);
+    arby::Nat value;
+
+    CHECK(stream >> value);
+    CHECK(value == 9 * arby::ipow(10, 10000));
+}
+
+TEST_CASE("Using std::istream >> arby::Nat fails when there are no digits", "[stream-extraction]") {
+    std::string input = GENERATE("-1", "x", " +1");
+    std::istringstream stream(input);
+    arby::Nat value = 5;
+
+    CHECK_FALSE(stream >> value);
+    CHECK(value == 0);
+}
+
+TEST_CASE("Using std::istream >> arby::Nat fails at end of input", "[stream-extraction]") {
+    std::istringstream stream(GENERATE("", "   "));
+    arby::Nat value = 5;
+
+    CHECK_FALSE(stream >> value);
+    CHECK(stream.eof());
+}
+
+TEST_CASE("Using std::istream >> arby::Nat fails on a hexadecimal prefix without digits", "[stream-extraction]") {
+    std::istringstream stream("0xg");
+    arby::Nat value = 5;
+
+    CHECK_FALSE(stream >> std::hex >> value);
+    CHECK(value == 0);
+}
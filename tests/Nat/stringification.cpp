@@ -1,4 +1,7 @@
+#include <cstdint>
+
 #include <limits>
+#include <random>
 #include <sstream>
 #include <string>
 
@@ -110,3 +113,35 @@ TEST_CASE("(std::string)arby::Nat generates same string as std::cout << std::dec
 
     CHECK((std::string)arb == expected_str);
 }
+
+TEST_CASE("(std::string)arby::Nat of large powers of ten and their neighbours", "[stringification]") {
+    // powers of ten land exactly on the boundaries that the conversion splits values at
+    uintmax_t exponent = GENERATE(19u, 38u, 76u, 152u, 300u, 1001u);
+    arby::Nat power = arby::ipow(10, exponent);
+
+    CHECK((std::string)power == "1" + std::string(exponent, '0'));
+    CHECK((std::string)(power - 1) == std::string(exponent, '9'));
+    CHECK((std::string)(power + 1) == "1" + std::string(exponent - 1, '0') + "1");
+}
+
+TEST_CASE("std::ostream << std::hex << arby::Nat of large values", "[stringification]") {
+    uintmax_t bits = GENERATE(64u, 65u, 256u, 1000u, 4096u);
+    std::ostringstream generated;
+
+    generated << std::hex << (arby::Nat(1) << bits) - 1 << " " << std::oct << (arby::Nat(1) << bits);
+
+    std::string octal = (bits % 3 == 0 ? "1" : bits % 3 == 1 ? "2" : "4") + std::string(bits / 3, '0');
+    CHECK(generated.str() == std::string(bits / 4, 'f').insert(0, bits % 4 == 0 ? "" : "1") + " " + octal);
+}
+
+TEST_CASE("(std::string)arby::Nat round-trips through string constructor for large values", "[stringification]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::uniform_int_distribution<int> digit('0', '9');
+    std::string digits(200, '0');
+    digits[0] = '1';
+    for (std::size_t i = 1; i < digits.size(); i++) {
+        digits[i] = (char)digit(engine);
+    }
+
+    CHECK((std::string)arby::Nat(digits) == digits);
+}
@@ -0,0 +1,191 @@
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+
+TEST_CASE("Three-operand functions match the operators", "[math-support][three-operand]") {
+    std::mt19937 engine(GENERATE(take(20, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::uniform_int_distribution<std::size_t> sizes(1, 12);
+    arby::Nat a = random_nat(engine, sizes(engine));
+    arby::Nat b = random_nat(engine, sizes(engine));
+    if (a < b) {
+        std::swap(a, b);
+    }
+    // destination starts off with a value of some other size, to check it gets resized either way
+    arby::Nat out = random_nat(engine, sizes(engine));
+    uintmax_t shift = GENERATE(0u, 1u, 32u, 77u);
+
+    SECTION("add()") {
+        arby::add(out, a, b);
+        CHECK(out == a + b);
+    }
+    SECTION("sub()") {
+        arby::sub(out, a, b);
+        CHECK(out == a - b);
+    }
+    SECTION("mul()") {
+        arby::mul(out, a, b);
+        CHECK(out == a * b);
+    }
+    SECTION("shl()") {
+        arby::shl(out, a, shift);
+        CHECK(out == (a << shift));
+    }
+    SECTION("shr()") {
+        arby::shr(out, a, shift);
+        CHECK(out == (a >> shift));
+    }
+    SECTION("and_()") {
+        arby::and_(out, a, b);
+        CHECK(out == (a & b));
+    }
+    SECTION("or_()") {
+        arby::or_(out, a, b);
+        CHECK(out == (a | b));
+    }
+    SECTION("xor_()") {
+        arby::xor_(out, a, b);
+        CHECK(out == (a ^ b));
+    }
+}
+
+TEST_CASE("Three-operand functions with the destination aliasing an operand", "[math-support][three-operand]") {
+    std::mt19937 engine(GENERATE(take(20, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::uniform_int_distribution<std::size_t> sizes(1, 12);
+    arby::Nat a = random_nat(engine, sizes(engine));
+    arby::Nat b = random_nat(engine, sizes(engine));
+    if (a < b) {
+        std::swap(a, b);
+    }
+    arby::Nat x = a;
+    arby::Nat y = b;
+
+    SECTION("add()") {
+        arby::add(x, x, y);
+        arby::add(y, x, y);
+        CHECK(x == a + b);
+        CHECK(y == a + b + b);
+    }
+    SECTION("sub()") {
+        arby::sub(y, x, y);
+        CHECK(y == a - b);
+        arby::sub(x, x, y);
+        CHECK(x == b);
+    }
+    SECTION("mul()") {
+        arby::mul(x, x, y);
+        CHECK(x == a * b);
+        arby::mul(y, x, y);
+        CHECK(y == a * b * b);
+    }
+    SECTION("shl() and shr()") {
+        arby::shl(x, x, 45);
+        CHECK(x == (a << 45));
+        arby::shr(x, x, 45);
+        CHECK(x == a);
+    }
+    SECTION("bitwise") {
+        arby::and_(x, x, y);
+        CHECK(x == (a & b));
+        x = a;
+        arby::or_(y, x, y);
+        CHECK(y == (a | b));
+        y = b;
+        arby::xor_(y, x, y);
+        CHECK(y == (a ^ b));
+    }
+    SECTION("All arguments the same") {
+        arby::add(x, x, x);
+        CHECK(x == a + a);
+        arby::mul(x, x, x);
+        CHECK(x == (a + a) * (a + a));
+        arby::sub(x, x, x);
+        CHECK(x == 0);
+    }
+}
+
+TEST_CASE("sub() underflow leaves the destination unchanged", "[math-support][three-operand]") {
+    arby::Nat out = 1234;
+
+    CHECK_THROWS_AS(arby::sub(out, 5, 6), std::underflow_error);
+    CHECK(out == 1234);
+}
+
+TEST_CASE("Three-operand functions with zero operands", "[math-support][three-operand]") {
+    arby::Nat out = arby::Nat(1) << 200;
+    arby::Nat big = (arby::Nat(1) << 100) + 1;
+
+    arby::mul(out, big, 0);
+    CHECK(out == 0);
+    CHECK(out.digit_length() == 1);
+    arby::shr(out, big, 101);
+    CHECK(out == 0);
+    arby::shl(out, 0, 64);
+    CHECK(out == 0);
+    CHECK(out.digit_length() == 1);
+    arby::and_(out, big, 2);
+    CHECK(out == 0);
+    CHECK(out.digit_length() == 1);
+}
+
+TEST_CASE("Four-operand divmod() matches two-operand divmod()", "[math-support][three-operand][divmod]") {
+    std::mt19937 engine(GENERATE(take(20, random(0u, std::numeric_limits<unsigned>::max()))));
+    std::uniform_int_distribution<std::size_t> sizes(1, 12);
+    arby::Nat lhs = random_nat(engine, sizes(engine));
+    arby::Nat rhs = random_nat(engine, sizes(engine));
+    arby::Nat quotient = 42;
+    arby::Nat remainder = arby::Nat(7) << 500;
+
+    arby::divmod(quotient, remainder, lhs, rhs);
+
+    CHECK(quotient * rhs + remainder == lhs);
+    CHECK(remainder < rhs);
+    auto expected = arby::divmod(lhs, rhs);
+    CHECK(quotient == expected.quotient);
+    CHECK(remainder == expected.remainder);
+}
+
+TEST_CASE("Four-operand divmod() with outputs aliasing the operands", "[math-support][three-operand][divmod]") {
+    std::mt19937 engine(GENERATE(take(10, random(0u, std::numeric_limits<unsigned>::max()))));
+    arby::Nat lhs = random_nat(engine, 9);
+    arby::Nat rhs = random_nat(engine, 4);
+    auto expected = arby::divmod(lhs, rhs);
+    arby::Nat quotient = lhs;
+    arby::Nat remainder = rhs;
+
+    arby::divmod(quotient, remainder, quotient, remainder);
+
+    CHECK(quotient == expected.quotient);
+    CHECK(remainder == expected.remainder);
+}
+
+TEST_CASE("Four-operand divmod() errors", "[math-support][three-operand][divmod]") {
+    arby::Nat quotient;
+    arby::Nat remainder;
+
+    CHECK_THROWS_AS(arby::divmod(quotient, remainder, 10, 0), std::domain_error);
+    CHECK_THROWS_AS(arby::divmod(quotient, quotient, 10, 3), std::invalid_argument);
+}
+
+TEST_CASE("divmod() when the quotient digit estimate needs correcting", "[math-support][divmod]") {
+    // divisors with a leading digit of all ones and a large second digit are the worst case for the estimate
+    arby::Nat max_digit = std::numeric_limits<arby::Nat::StorageType>::max();
+    std::mt19937 engine(GENERATE(take(20, random(0u, std::numeric_limits<unsigned>::max()))));
+    arby::Nat rhs = (max_digit << 64) + (random_nat(engine, 1) << 32) + random_nat(engine, 1);
+    arby::Nat lhs = rhs * random_nat(engine, 5) + random_nat(engine, 2);
+
+    auto [quotient, remainder] = arby::divmod(lhs, rhs);
+
+    CHECK(quotient * rhs + remainder == lhs);
+    CHECK(remainder < rhs);
+}
@@ -65,6 +65,22 @@ TEST_CASE("Initialising arby::Nat objects with binary _nat user-defined-literal"
     CHECK(literal == object);
 }
 
+TEST_CASE("Initialising arby::Nat objects with hexadecimal and binary _nat user-defined-literals spanning many digits", "[user-defined-literal]") {
+    auto [literal, object] = GENERATE(
+        table<arby::Nat, arby::Nat>(
+            {
+                {0x100000000000000000000000000000000_nat, arby::Nat(1) << 128},
+                {0x0000000000000000000000000000000000001_nat, 1},
+                {0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_nat, (arby::Nat(1) << 160) - 1},
+                {0x123456789abcdef0123456789abcdef0_nat, (arby::Nat(0x123456789abcdef0) << 64) + 0x123456789abcdef0},
+                {0b110000000000000000000000000000000000000000000000000000000000000000000_nat, arby::Nat(3) << 67},
+            }
+        )
+    );
+
+    CHECK(literal == object);
+}
+
 TEST_CASE("Malformed octal _nat literal throws std::invalid_argument") {
     CHECK_THROWS_AS(01234_nat, std::invalid_argument);
 }
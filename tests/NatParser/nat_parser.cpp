@@ -0,0 +1,107 @@
+#include <cstddef>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <arby/Nat.hpp>
+#include <arby/NatParser.hpp>
+
+#include "random_nat.hpp"
+
+using namespace com::saxbophone;
+using namespace com::saxbophone::arby::literals;
+
+// writes value in the given base
+static std::string digits_of(const arby::Nat& value, int base) {
+    std::string digits(value.chars_needed(base), '\0');
+    digits.resize((std::size_t)(arby::to_chars(digits.data(), digits.data() + digits.size(), value, base).ptr - digits.data()));
+    return digits;
+}
+
+TEST_CASE("arby::NatParser with nothing fed has value zero", "[nat-parser]") {
+    arby::NatParser parser;
+
+    CHECK(parser.size() == 0);
+    CHECK(parser.value() == 0);
+}
+
+TEST_CASE("arby::NatParser fed all digits at once", "[nat-parser]") {
+    arby::NatParser parser;
+    parser.feed("1234567890123456789012345678901234567890");
+
+    CHECK(parser.size() == 40);
+    CHECK(parser.value() == 1234567890123456789012345678901234567890_nat);
+}
+
+// reads the digits in one go, for comparison
+static arby::Nat value_of(std::string_view digits, int base) {
+    arby::Nat value;
+    arby::from_chars(digits.data(), digits.data() + digits.size(), value, base);
+    return value;
+}
+
+TEST_CASE("arby::NatParser gives the same value however the digits are split up", "[nat-parser]") {
+    std::mt19937 engine(GENERATE(1u, 2u));
+    int base = GENERATE(10, 16, 7, 2, 36);
+    arby::Nat value = random_nat(engine, GENERATE(1u, 30u, 300u));
+    std::string digits = digits_of(value, base);
+    std::size_t piece = GENERATE(1u, 7u, 1216u, 5000u);
+    arby::NatParser parser(base);
+    std::size_t fed = 0;
+    for (std::size_t pieces = 1; fed < digits.size(); pieces++) {
+        std::size_t count = std::min(piece, digits.size() - fed);
+        parser.feed(std::string_view(digits).substr(fed, count));
+        fed += count;
+        // reading the value part-way through shouldn't disturb the parser
+        if (pieces % 97 == 0) {
+            CHECK(parser.value() == value_of(std::string_view(digits).substr(0, fed), base));
+        }
+    }
+
+    CHECK(parser.size() == digits.size());
+    CHECK(parser.value() == value);
+}
+
+TEST_CASE("arby::NatParser accepts leading zeroes and mixed case", "[nat-parser]") {
+    arby::NatParser parser(16);
+    parser.feed("0000").feed("DeadBeef").feed("CAFEbabe");
+
+    CHECK(parser.size() == 20);
+    CHECK(parser.value() == 0xdeadbeefcafebabe_nat);
+}
+
+TEST_CASE("arby::NatParser rejects invalid digits without reading any of the piece", "[nat-parser]") {
+    arby::NatParser parser;
+    parser.feed("123");
+
+    CHECK_THROWS_WITH(parser.feed("45a6"), "invalid digit 'a' at position 5 for base 10");
+    CHECK(parser.size() == 3);
+    CHECK(parser.value() == 123);
+}
+
+TEST_CASE("arby::NatParser rejects bases outside 2 to 36", "[nat-parser]") {
+    int base = GENERATE(-1, 0, 1, 37);
+
+    CHECK_THROWS_AS(arby::NatParser(base), std::invalid_argument);
+}
+
+TEST_CASE("arby::NatParser benchmarks", "[.][benchmark]") {
+    std::mt19937 engine;
+    std::string digits = digits_of(random_nat(engine, 10000), 10);
+
+    BENCHMARK("Parsing 96k decimal digits in pieces of 4096") {
+        arby::NatParser parser;
+        for (std::size_t i = 0; i < digits.size(); i += 4096) {
+            parser.feed(std::string_view(digits).substr(i, 4096));
+        }
+        return parser.value();
+    };
+}
@@ -0,0 +1,50 @@
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <arby/SqrtResult.hpp>
+#include <arby/Nat.hpp>
+
+using namespace com::saxbophone;
+
+TEMPLATE_TEST_CASE("default SqrtResult", "[sqrt-result]", int, unsigned long, arby::Nat) {
+    arby::SqrtResult<TestType> def;
+
+    CHECK(def.root == 0);
+    CHECK(def.remainder == 0);
+}
+
+TEMPLATE_TEST_CASE("SqrtResult from root,remainder", "[sqrt-result]", int, unsigned long, arby::Nat) {
+    arby::SqrtResult<TestType> input(122, 76);
+
+    CHECK(input.root == 122);
+    CHECK(input.remainder == 76);
+}
+
+TEMPLATE_TEST_CASE("Structured binding from SqrtResult", "[sqrt-result]", int, unsigned long, arby::Nat) {
+    arby::SqrtResult<TestType> input(133, 99);
+
+    auto [root, remainder] = input;
+
+    CHECK(root == 133);
+    CHECK(remainder == 99);
+}
+
+TEST_CASE("SqrtResult<T> can be cast to SqrtResult<U> where (T)U is valid", "[sqrt-result]") {
+    using T = unsigned int;
+    using U = long;
+
+    arby::SqrtResult<T> input(987, 232);
+
+    arby::SqrtResult<U> output = input;
+
+    CHECK(output.root == 987);
+    CHECK(output.remainder == 232);
+}
+
+TEST_CASE("SqrtResult can be compared to SqrtResult", "[sqrt-result]") {
+    arby::SqrtResult<int> a(64, 23);
+    arby::SqrtResult<int> b = a;
+
+    CHECK(a == b);
+}
@@ -4,4 +4,6 @@
  * https://github.com/catchorg/Catch2/blob/master/docs/slow-compiles.md#practical-example
  */
 #define CATCH_CONFIG_MAIN
+// benchmarks are tagged [.][benchmark] so they only run when asked for by tag
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
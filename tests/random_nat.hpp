@@ -0,0 +1,24 @@
+#ifndef COM_SAXBOPHONE_ARBY_TESTS_RANDOM_NAT_HPP
+#define COM_SAXBOPHONE_ARBY_TESTS_RANDOM_NAT_HPP
+
+#include <cstddef>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <arby/Nat.hpp>
+
+
+// builds a random arby::Nat of exactly the given number of digits
+inline com::saxbophone::arby::Nat random_nat(std::mt19937& engine, std::size_t digits) {
+    using com::saxbophone::arby::Nat;
+    std::uniform_int_distribution<Nat::StorageType> distribution(1, std::numeric_limits<Nat::StorageType>::max());
+    std::vector<Nat::StorageType> value(digits);
+    for (auto& digit : value) {
+        digit = distribution(engine);
+    }
+    return value;
+}
+
+#endif // include guard